@@ -0,0 +1,422 @@
+﻿using Microsoft.Build.Framework;
+using Microsoft.Build.Utilities;
+using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.IO;
+using System.Linq;
+using System.Runtime.Serialization.Json;
+using System.Text;
+using System.Xml;
+using System.Xml.Linq;
+
+namespace Lvgl.Build.Tasks
+{
+    public class CompareBenchmarkResults : Task
+    {
+        [Required]
+        public ITaskItem[] BaselineFiles { get; set; }
+
+        [Required]
+        public ITaskItem[] CurrentFiles { get; set; }
+
+        /// <summary>
+        /// The optional CSV file with the "scene", "render_tolerance" and
+        /// "memory_tolerance" columns, which overrides the default tolerances
+        /// for the specified scenes.
+        /// </summary>
+        public string ToleranceFilePath { get; set; }
+
+        /// <summary>
+        /// The allowed render time regression in percent.
+        /// </summary>
+        public double RenderTimeTolerance { get; set; } = 10.0;
+
+        /// <summary>
+        /// The allowed peak memory regression in percent.
+        /// </summary>
+        public double PeakMemoryTolerance { get; set; } = 5.0;
+
+        /// <summary>
+        /// The number of standard errors the difference of the means must
+        /// exceed to be considered as a regression instead of noise when
+        /// there are repeated runs. 2.0 is about 95% confidence.
+        /// </summary>
+        public double SignificanceThreshold { get; set; } = 2.0;
+
+        private class Samples
+        {
+            public List<double> RenderTimes = new List<double>();
+            public List<double> PeakMemories = new List<double>();
+        }
+
+        private static List<Dictionary<string, string>> ParseCsvFile(
+            string FilePath)
+        {
+            List<Dictionary<string, string>> Result =
+                new List<Dictionary<string, string>>();
+
+            string[] Lines = File.ReadAllLines(FilePath, Encoding.UTF8);
+            if (Lines.Length == 0)
+            {
+                return Result;
+            }
+
+            string[] Header = Lines[0].Trim().Split(',');
+
+            for (int i = 1; i < Lines.Length; ++i)
+            {
+                string Line = Lines[i].Trim();
+                if (Line.Length == 0)
+                {
+                    continue;
+                }
+
+                string[] Values = Line.Split(',');
+                Dictionary<string, string> Row =
+                    new Dictionary<string, string>();
+                for (int j = 0; j < Header.Length && j < Values.Length; ++j)
+                {
+                    Row[Header[j].Trim()] = Values[j].Trim();
+                }
+                Result.Add(Row);
+            }
+
+            return Result;
+        }
+
+        /// <summary>
+        /// Parses the "scenes" array of the benchmark result file in JSON
+        /// format, where every scene object is converted to a row keyed by
+        /// its property names, which is the same as the CSV format.
+        /// </summary>
+        private static List<Dictionary<string, string>> ParseJsonFile(
+            string FilePath)
+        {
+            List<Dictionary<string, string>> Result =
+                new List<Dictionary<string, string>>();
+
+            XElement Root;
+            using (XmlDictionaryReader Reader =
+                JsonReaderWriterFactory.CreateJsonReader(
+                    File.ReadAllBytes(FilePath),
+                    XmlDictionaryReaderQuotas.Max))
+            {
+                Root = XElement.Load(Reader);
+            }
+
+            XElement Scenes = Root.Element("scenes");
+            if (Scenes == null)
+            {
+                return Result;
+            }
+
+            foreach (XElement Scene in Scenes.Elements("item"))
+            {
+                Dictionary<string, string> Row =
+                    new Dictionary<string, string>();
+                foreach (XElement Property in Scene.Elements())
+                {
+                    Row[Property.Name.LocalName] = Property.Value.Trim();
+                }
+                Result.Add(Row);
+            }
+
+            return Result;
+        }
+
+        private static List<Dictionary<string, string>> ParseResultFile(
+            string FilePath)
+        {
+            if (string.Equals(
+                Path.GetExtension(FilePath),
+                ".json",
+                StringComparison.OrdinalIgnoreCase))
+            {
+                return ParseJsonFile(FilePath);
+            }
+
+            return ParseCsvFile(FilePath);
+        }
+
+        private static double ParseNumber(
+            Dictionary<string, string> Row,
+            string Name)
+        {
+            string Value;
+            if (Row.TryGetValue(Name, out Value))
+            {
+                double Result;
+                if (double.TryParse(
+                    Value,
+                    NumberStyles.Float,
+                    CultureInfo.InvariantCulture,
+                    out Result))
+                {
+                    return Result;
+                }
+            }
+            return double.NaN;
+        }
+
+        private SortedDictionary<string, Samples> LoadResults(
+            ITaskItem[] Files)
+        {
+            SortedDictionary<string, Samples> Result =
+                new SortedDictionary<string, Samples>();
+
+            foreach (ITaskItem Item in Files)
+            {
+                string FilePath = Path.GetFullPath(Item.ItemSpec);
+                if (!File.Exists(FilePath))
+                {
+                    Log.LogError(
+                        "Please ensure that the benchmark result file '{0}' exists.",
+                        FilePath);
+                    continue;
+                }
+
+                List<Dictionary<string, string>> Rows;
+                try
+                {
+                    Rows = ParseResultFile(FilePath);
+                }
+                catch (XmlException)
+                {
+                    Log.LogError(
+                        "Please ensure that '{0}' is a benchmark result file in JSON format.",
+                        FilePath);
+                    continue;
+                }
+
+                foreach (var Row in Rows)
+                {
+                    string Scene;
+                    if (!Row.TryGetValue("scene", out Scene))
+                    {
+                        Log.LogError(
+                            "Please ensure that '{0}' is a benchmark result file in CSV or JSON format.",
+                            FilePath);
+                        break;
+                    }
+
+                    Samples Current;
+                    if (!Result.TryGetValue(Scene, out Current))
+                    {
+                        Current = new Samples();
+                        Result.Add(Scene, Current);
+                    }
+
+                    double RenderTime = ParseNumber(Row, "render_avg_us");
+                    if (!double.IsNaN(RenderTime))
+                    {
+                        Current.RenderTimes.Add(RenderTime);
+                    }
+
+                    double PeakMemory = ParseNumber(Row, "peak_memory");
+                    if (!double.IsNaN(PeakMemory))
+                    {
+                        Current.PeakMemories.Add(PeakMemory);
+                    }
+                }
+            }
+
+            return Result;
+        }
+
+        private Dictionary<string, Tuple<double, double>> LoadTolerances()
+        {
+            Dictionary<string, Tuple<double, double>> Result =
+                new Dictionary<string, Tuple<double, double>>();
+
+            if (string.IsNullOrEmpty(ToleranceFilePath))
+            {
+                return Result;
+            }
+
+            string FilePath = Path.GetFullPath(ToleranceFilePath);
+            if (!File.Exists(FilePath))
+            {
+                Log.LogError(
+                    "Please ensure that the tolerance file '{0}' exists.",
+                    FilePath);
+                return Result;
+            }
+
+            foreach (var Row in ParseCsvFile(FilePath))
+            {
+                string Scene;
+                if (!Row.TryGetValue("scene", out Scene))
+                {
+                    continue;
+                }
+
+                double RenderTolerance = ParseNumber(Row, "render_tolerance");
+                double MemoryTolerance = ParseNumber(Row, "memory_tolerance");
+
+                Result[Scene] = Tuple.Create(
+                    double.IsNaN(RenderTolerance)
+                        ? RenderTimeTolerance
+                        : RenderTolerance,
+                    double.IsNaN(MemoryTolerance)
+                        ? PeakMemoryTolerance
+                        : MemoryTolerance);
+            }
+
+            return Result;
+        }
+
+        private static double GetMean(
+            List<double> Values)
+        {
+            return Values.Count > 0 ? Values.Average() : double.NaN;
+        }
+
+        private static double GetVariance(
+            List<double> Values)
+        {
+            if (Values.Count < 2)
+            {
+                return 0.0;
+            }
+
+            double Mean = GetMean(Values);
+            double Sum = 0.0;
+            foreach (double Value in Values)
+            {
+                Sum += (Value - Mean) * (Value - Mean);
+            }
+            return Sum / (Values.Count - 1);
+        }
+
+        private bool CheckRegression(
+            string Scene,
+            string Metric,
+            List<double> Baseline,
+            List<double> Current,
+            double Tolerance)
+        {
+            if (Baseline.Count == 0 || Current.Count == 0)
+            {
+                return true;
+            }
+
+            double BaselineMean = GetMean(Baseline);
+            double CurrentMean = GetMean(Current);
+            double Difference = CurrentMean - BaselineMean;
+            double Allowed = BaselineMean * Tolerance / 100.0;
+
+            // The standard error of the difference of the means, which is
+            // only available when both sides have repeated runs.
+            double StandardError = Math.Sqrt(
+                GetVariance(Baseline) / Baseline.Count +
+                GetVariance(Current) / Current.Count);
+
+            double Change = BaselineMean > 0.0
+                ? Difference * 100.0 / BaselineMean
+                : 0.0;
+
+            Log.LogMessage(
+                MessageImportance.Normal,
+                "Scene {0} {1}: {2:F1} -> {3:F1} ({4:+0.0;-0.0;0.0}%).",
+                Scene,
+                Metric,
+                BaselineMean,
+                CurrentMean,
+                Change);
+
+            if (Difference <= Allowed)
+            {
+                return true;
+            }
+
+            if (Difference <= SignificanceThreshold * StandardError)
+            {
+                Log.LogWarning(
+                    "Scene {0} {1} increased by {2:F1}% which is within the noise of the repeated runs.",
+                    Scene,
+                    Metric,
+                    Change);
+                return true;
+            }
+
+            Log.LogError(
+                "Scene {0} {1} regressed from {2:F1} to {3:F1} ({4:F1}%), which exceeds the tolerance of {5:F1}%.",
+                Scene,
+                Metric,
+                BaselineMean,
+                CurrentMean,
+                Change,
+                Tolerance);
+            return false;
+        }
+
+        public override bool Execute()
+        {
+            SortedDictionary<string, Samples> BaselineResults =
+                LoadResults(BaselineFiles);
+            SortedDictionary<string, Samples> CurrentResults =
+                LoadResults(CurrentFiles);
+            Dictionary<string, Tuple<double, double>> Tolerances =
+                LoadTolerances();
+            if (Log.HasLoggedErrors)
+            {
+                return false;
+            }
+
+            if (BaselineResults.Count == 0 || CurrentResults.Count == 0)
+            {
+                Log.LogError("Please ensure that the benchmark results are not empty.");
+                return false;
+            }
+
+            foreach (var BaselineResult in BaselineResults)
+            {
+                Samples CurrentResult;
+                if (!CurrentResults.TryGetValue(
+                    BaselineResult.Key,
+                    out CurrentResult))
+                {
+                    Log.LogError(
+                        "Scene {0} is missing in the current benchmark results.",
+                        BaselineResult.Key);
+                    continue;
+                }
+
+                Tuple<double, double> Tolerance;
+                if (!Tolerances.TryGetValue(
+                    BaselineResult.Key,
+                    out Tolerance))
+                {
+                    Tolerance = Tuple.Create(
+                        RenderTimeTolerance,
+                        PeakMemoryTolerance);
+                }
+
+                CheckRegression(
+                    BaselineResult.Key,
+                    "render time",
+                    BaselineResult.Value.RenderTimes,
+                    CurrentResult.RenderTimes,
+                    Tolerance.Item1);
+
+                CheckRegression(
+                    BaselineResult.Key,
+                    "peak memory",
+                    BaselineResult.Value.PeakMemories,
+                    CurrentResult.PeakMemories,
+                    Tolerance.Item2);
+            }
+
+            if (!Log.HasLoggedErrors)
+            {
+                Log.LogMessage(
+                    MessageImportance.High,
+                    "No performance regression found in {0} scenes.",
+                    BaselineResults.Count);
+            }
+
+            return !Log.HasLoggedErrors;
+        }
+    }
+}
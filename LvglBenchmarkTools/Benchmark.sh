@@ -0,0 +1,256 @@
+#!/bin/sh
+#
+# PROJECT:   LVGL Platform for Windows
+# FILE:      Benchmark.sh
+# PURPOSE:   Measure the headless simulator with different build or run options
+#
+# LICENSE:   The MIT License
+#
+# MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+#
+# Usage: ./Benchmark.sh draw-units [max-draw-units] [output-folder]
+#        ./Benchmark.sh draw-cache [draw-cache-size] [output-folder]
+#        ./Benchmark.sh allocator [output-folder]
+#        ./Benchmark.sh neon [output-folder]
+#
+# draw-units
+#   The simulator is rebuilt with LVGL_DRAW_SW_DRAW_UNIT_CNT set from 1 to the
+#   specified maximum, which defaults to the number of processors capped to 8,
+#   and the lv_demo_benchmark results are written to Units<N>.csv. The parallel
+#   draw unit is disabled via --draw-workers=0, so only the built-in software
+#   draw units render and the results only depend on their count. The output
+#   folder defaults to Output/DrawUnitScaling.
+#
+# draw-cache
+#   The image cache benchmark scene is measured with the draw caches disabled
+#   and with the specified unified budget in bytes, which defaults to the
+#   default of the simulator, and the results are written to CacheOff.csv and
+#   CacheOn.csv. The output folder defaults to Output/DrawCache.
+#
+# allocator
+#   The simulator is built with LVGL_STDLIB_MALLOC set to CLIB, BUILTIN and
+#   CUSTOM, which is the slab allocator of LvglSlabAllocator, and the results
+#   of the --alloc-benchmark option are written to <backend>.txt. The output
+#   folder defaults to Output/Allocator.
+#
+# neon
+#   The simulator is cross built for ARM64 Linux via aarch64-linux-gnu.cmake
+#   with the LVGL_SIMD_BLEND_NEON CMake option off and on, and run via
+#   qemu-user. The output of the --blend-self-test option, which checks the
+#   NEON kernels are bit-exact against the C implementation and measures every
+#   kernel, is written to SelfTest<Off|On>.txt, and the lv_demo_benchmark
+#   results are written to Benchmark<Off|On>.csv. The emulated timings only
+#   compare the kernels with each other, and are not the performance of ARM64
+#   hardware. The output folder defaults to Output/Neon.
+#
+# Every mode prints a summary with the speedup relative to the first variant.
+#
+
+set -e
+
+ROOT_DIR=$(cd "$(dirname "$0")/.." && pwd)
+
+usage()
+{
+    sed -n 's/^# Usage: \.\/\(.*\)$/Usage: \1/p; s/^#        \.\//       /p' \
+        "$0" >&2
+    exit 1
+}
+
+# build_simulator <build-folder> [cmake-options...]
+build_simulator()
+{
+    BUILD_DIR=$1
+    shift
+    cmake \
+        -S "$ROOT_DIR" \
+        -B "$BUILD_DIR" \
+        -DCMAKE_BUILD_TYPE=Release \
+        "$@" > /dev/null
+    cmake --build "$BUILD_DIR" --target LvglWindowsSimulator > /dev/null
+}
+
+# sum_render_time <variant> <benchmark-output>
+#
+# Prints the variant and the sum of the average render time of all scenes.
+sum_render_time()
+{
+    awk -F, -v variant="$1" '
+        NR == 1 {
+            for (i = 1; i <= NF; ++i) {
+                if ($i == "render_avg_us") {
+                    column = i;
+                }
+            }
+            next;
+        }
+        { sum += $column; }
+        END { print variant "," sum; }
+    ' "$2"
+}
+
+# print_speedup <header>
+#
+# Reads the lines of the variants, sums the columns after the variant name,
+# and appends the speedup of the sum relative to the first line.
+print_speedup()
+{
+    echo
+    echo "$1,speedup"
+    awk -F, '
+        {
+            total = 0;
+            for (i = 2; i <= NF; ++i) {
+                total += $i;
+            }
+            if (NR == 1) {
+                baseline = total;
+            }
+            printf("%s,%.2f\n", $0, total ? baseline / total : 0);
+        }
+    '
+}
+
+benchmark_draw_units()
+{
+    MAX_DRAW_UNITS=${1:-$(nproc 2>/dev/null || echo 1)}
+    if [ -z "$1" ] && [ "$MAX_DRAW_UNITS" -gt 8 ]; then
+        MAX_DRAW_UNITS=8
+    fi
+
+    OUTPUT_DIR=${2:-$ROOT_DIR/Output/DrawUnitScaling}
+    mkdir -p "$OUTPUT_DIR"
+
+    for DRAW_UNITS in $(seq 1 "$MAX_DRAW_UNITS"); do
+        echo "Building with $DRAW_UNITS draw unit(s)..."
+        build_simulator \
+            "$OUTPUT_DIR/Build" \
+            -DLVGL_DRAW_SW_DRAW_UNIT_CNT="$DRAW_UNITS"
+
+        echo "Running lv_demo_benchmark with $DRAW_UNITS draw unit(s)..."
+        "$BUILD_DIR/LvglWindowsSimulator" \
+            --headless \
+            --draw-workers=0 \
+            --benchmark-output="$OUTPUT_DIR/Units$DRAW_UNITS.csv"
+    done
+
+    for DRAW_UNITS in $(seq 1 "$MAX_DRAW_UNITS"); do
+        sum_render_time "$DRAW_UNITS" "$OUTPUT_DIR/Units$DRAW_UNITS.csv"
+    done | print_speedup "draw_units,render_sum_us"
+}
+
+benchmark_draw_cache()
+{
+    DRAW_CACHE_SIZE=$1
+
+    OUTPUT_DIR=${2:-$ROOT_DIR/Output/DrawCache}
+    mkdir -p "$OUTPUT_DIR"
+
+    echo "Building..."
+    build_simulator "$OUTPUT_DIR/Build"
+
+    for DRAW_CACHE in Off On; do
+        if [ "$DRAW_CACHE" = Off ]; then
+            echo "Running the image cache scene with the draw caches off..."
+            SIZE=0
+        else
+            echo "Running the image cache scene with the draw caches on..."
+            SIZE=$DRAW_CACHE_SIZE
+        fi
+        "$BUILD_DIR/LvglWindowsSimulator" \
+            --headless \
+            --demo=image-cache \
+            --benchmark-scene-timeout=1000 \
+            --benchmark-output="$OUTPUT_DIR/Cache$DRAW_CACHE.csv" \
+            ${SIZE:+--draw-cache-size="$SIZE"} \
+            --draw-cache-dump
+    done
+
+    for DRAW_CACHE in Off On; do
+        sum_render_time "$DRAW_CACHE" "$OUTPUT_DIR/Cache$DRAW_CACHE.csv"
+    done | print_speedup "draw_cache,render_avg_us"
+}
+
+benchmark_allocator()
+{
+    OUTPUT_DIR=${1:-$ROOT_DIR/Output/Allocator}
+    mkdir -p "$OUTPUT_DIR"
+
+    for BACKEND in CLIB BUILTIN CUSTOM; do
+        echo "Building with the $BACKEND allocator..."
+        build_simulator \
+            "$OUTPUT_DIR/Build$BACKEND" \
+            -DLVGL_STDLIB_MALLOC="$BACKEND"
+
+        echo "Running the widgets demo with the $BACKEND allocator..."
+        "$BUILD_DIR/LvglWindowsSimulator" \
+            --headless \
+            --alloc-benchmark > "$OUTPUT_DIR/$BACKEND.txt"
+    done
+
+    for BACKEND in CLIB BUILTIN CUSTOM; do
+        awk -F, -v backend="$BACKEND" '
+            $1 == "create" { create = $2; }
+            $1 == "render" { render = $2; }
+            $1 == "delete" { delete_time = $2; }
+            END { print backend "," create "," render "," delete_time; }
+        ' "$OUTPUT_DIR/$BACKEND.txt"
+    done | print_speedup "allocator,create_us,render_us,delete_us"
+}
+
+benchmark_neon()
+{
+    OUTPUT_DIR=${1:-$ROOT_DIR/Output/Neon}
+    mkdir -p "$OUTPUT_DIR"
+
+    EMULATOR=${LVGL_AARCH64_EMULATOR:-qemu-aarch64}
+    SYSROOT=${LVGL_AARCH64_SYSROOT:-/usr/aarch64-linux-gnu}
+    TOOLCHAIN_FILE=$ROOT_DIR/LvglBenchmarkTools/aarch64-linux-gnu.cmake
+
+    SUCCEEDED=1
+    for NEON in Off On; do
+        STATE=$(echo "$NEON" | tr A-Z a-z)
+
+        echo "Building for ARM64 with the NEON blend kernels $STATE..."
+        build_simulator \
+            "$OUTPUT_DIR/Build$NEON" \
+            -DCMAKE_TOOLCHAIN_FILE="$TOOLCHAIN_FILE" \
+            -DLVGL_AARCH64_EMULATOR="$EMULATOR" \
+            -DLVGL_AARCH64_SYSROOT="$SYSROOT" \
+            -DLVGL_SIMD_BLEND_NEON="$(echo "$NEON" | tr a-z A-Z)"
+
+        echo "Running the blend self test with the NEON blend kernels $STATE..."
+        if ! "$EMULATOR" -L "$SYSROOT" \
+            "$BUILD_DIR/LvglWindowsSimulator" \
+            --blend-self-test > "$OUTPUT_DIR/SelfTest$NEON.txt"; then
+            SUCCEEDED=0
+        fi
+        cat "$OUTPUT_DIR/SelfTest$NEON.txt"
+
+        echo "Running lv_demo_benchmark with the NEON blend kernels $STATE..."
+        "$EMULATOR" -L "$SYSROOT" \
+            "$BUILD_DIR/LvglWindowsSimulator" \
+            --headless \
+            --benchmark-output="$OUTPUT_DIR/Benchmark$NEON.csv"
+    done
+
+    for NEON in Off On; do
+        sum_render_time "$NEON" "$OUTPUT_DIR/Benchmark$NEON.csv"
+    done | print_speedup "neon,render_sum_us"
+
+    if [ "$SUCCEEDED" -eq 0 ]; then
+        echo "The blend self test failed, see SelfTest<Off|On>.txt." >&2
+        exit 1
+    fi
+}
+
+MODE=$1
+[ $# -gt 0 ] && shift
+
+case "$MODE" in
+    draw-units) benchmark_draw_units "$@" ;;
+    draw-cache) benchmark_draw_cache "$@" ;;
+    allocator) benchmark_allocator "$@" ;;
+    neon) benchmark_neon "$@" ;;
+    *) usage ;;
+esac
@@ -0,0 +1,38 @@
+﻿#
+# PROJECT:   LVGL Platform for Windows
+# FILE:      aarch64-linux-gnu.cmake
+# PURPOSE:   CMake toolchain file for cross building for ARM64 Linux hosts
+#
+# LICENSE:   The MIT License
+#
+# MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+#
+# Usage: cmake -DCMAKE_TOOLCHAIN_FILE=LvglBenchmarkTools/aarch64-linux-gnu.cmake
+#
+# The GNU cross compilers are used by default, and the binaries are run via
+# qemu-user with the sysroot of the cross compilers, e.g. the
+# gcc-aarch64-linux-gnu, g++-aarch64-linux-gnu and qemu-user packages of
+# Debian and Ubuntu.
+#
+
+set(CMAKE_SYSTEM_NAME Linux)
+set(CMAKE_SYSTEM_PROCESSOR aarch64)
+
+set(LVGL_AARCH64_TOOLCHAIN_PREFIX "aarch64-linux-gnu-" CACHE STRING
+  "The prefix of the cross compilers.")
+set(LVGL_AARCH64_SYSROOT "/usr/aarch64-linux-gnu" CACHE PATH
+  "The sysroot of the cross compilers, which is also used by qemu-user.")
+set(LVGL_AARCH64_EMULATOR "qemu-aarch64" CACHE STRING
+  "The qemu-user emulator for running the cross built binaries.")
+
+set(CMAKE_C_COMPILER "${LVGL_AARCH64_TOOLCHAIN_PREFIX}gcc")
+set(CMAKE_CXX_COMPILER "${LVGL_AARCH64_TOOLCHAIN_PREFIX}g++")
+
+set(CMAKE_FIND_ROOT_PATH "${LVGL_AARCH64_SYSROOT}")
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_PACKAGE ONLY)
+
+set(CMAKE_CROSSCOMPILING_EMULATOR
+  "${LVGL_AARCH64_EMULATOR};-L;${LVGL_AARCH64_SYSROOT}")
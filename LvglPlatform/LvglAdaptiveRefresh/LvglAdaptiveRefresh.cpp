@@ -0,0 +1,290 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglAdaptiveRefresh.cpp
+ * PURPOSE:   Implementation for the adaptive refresh period of LVGL displays
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglAdaptiveRefresh.h"
+
+#include <LvglFrameScheduler.h>
+
+#include <cstdio>
+#include <vector>
+
+typedef struct _lv_adaptive_refresh_context_t
+{
+    lv_display_t* display;
+    uint32_t max_period;
+    uint32_t period;
+    uint32_t idle_level;
+    bool invalidated;
+    uint64_t snap_back_count;
+} lv_adaptive_refresh_context_t;
+
+// Only accessed from the LVGL thread.
+static std::vector<lv_adaptive_refresh_context_t*> g_adaptive_refresh_contexts;
+
+static lv_adaptive_refresh_context_t* lv_adaptive_refresh_find_context(
+    lv_display_t* display)
+{
+    for (lv_adaptive_refresh_context_t* context : g_adaptive_refresh_contexts)
+    {
+        if (display == context->display)
+        {
+            return context;
+        }
+    }
+
+    return NULL;
+}
+
+static void lv_adaptive_refresh_apply(
+    lv_adaptive_refresh_context_t* context,
+    uint32_t idle_level)
+{
+    uint32_t period = LV_DEF_REFR_PERIOD;
+    for (uint32_t i = 0; i < idle_level && period < context->max_period; ++i)
+    {
+        period *= 2;
+    }
+    period = LV_MIN(period, context->max_period);
+
+    bool snap_back = period < context->period;
+    context->idle_level = idle_level;
+    if (period == context->period)
+    {
+        return;
+    }
+    context->period = period;
+
+    if (snap_back)
+    {
+        ++context->snap_back_count;
+    }
+
+    // The frame scheduler keeps the refresh timer of its displays from
+    // expiring, so the minimum period of the scheduler is adjusted instead.
+    if (lv_frame_scheduler_set_min_period(
+        context->display,
+        LV_DEF_REFR_PERIOD == period ? 0 : period * 1000))
+    {
+        return;
+    }
+
+    lv_timer_t* refr_timer = lv_display_get_refr_timer(context->display);
+    if (refr_timer)
+    {
+        lv_timer_set_period(refr_timer, period);
+        if (snap_back)
+        {
+            lv_timer_ready(refr_timer);
+        }
+    }
+}
+
+static bool lv_adaptive_refresh_is_overlay_area(
+    lv_display_t* display,
+    const lv_area_t* area)
+{
+    // The overlays on the system layer, e.g. the sysmon and the statistics
+    // monitor, update their text periodically even if nothing else changes,
+    // so the invalidations inside them aren't considered as activity.
+    // Otherwise the refresh period is snapped back by every update and never
+    // reaches the maximum period.
+    lv_obj_t* layer = lv_display_get_layer_sys(display);
+    if (!layer || !area)
+    {
+        return false;
+    }
+
+    uint32_t child_count = lv_obj_get_child_count(layer);
+    for (uint32_t i = 0; i < child_count; ++i)
+    {
+        lv_obj_t* child = lv_obj_get_child(layer, static_cast<int32_t>(i));
+
+        lv_area_t coords;
+        lv_obj_get_coords(child, &coords);
+        int32_t ext_draw_size = lv_obj_get_ext_draw_size(child);
+        lv_area_increase(&coords, ext_draw_size, ext_draw_size);
+        if (lv_area_is_in(area, &coords, 0))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void lv_adaptive_refresh_activity(
+    lv_adaptive_refresh_context_t* context)
+{
+    if (context->idle_level)
+    {
+        lv_adaptive_refresh_apply(context, 0);
+    }
+}
+
+static void lv_adaptive_refresh_display_event_callback(
+    lv_event_t* e)
+{
+    lv_adaptive_refresh_context_t* context =
+        static_cast<lv_adaptive_refresh_context_t*>(
+            lv_event_get_user_data(e));
+
+    switch (lv_event_get_code(e))
+    {
+    case LV_EVENT_INVALIDATE_AREA:
+        if (!lv_adaptive_refresh_is_overlay_area(
+            context->display,
+            static_cast<const lv_area_t*>(lv_event_get_param(e))))
+        {
+            context->invalidated = true;
+            lv_adaptive_refresh_activity(context);
+        }
+        break;
+    case LV_EVENT_REFR_READY:
+    {
+        // The refreshes which only render the overlays are idle as well.
+        bool active = context->invalidated
+            || lv_anim_count_running()
+            || lv_display_get_inactive_time(context->display)
+                < context->period;
+        context->invalidated = false;
+        lv_adaptive_refresh_apply(
+            context,
+            active ? 0 : context->idle_level + 1);
+        break;
+    }
+    case LV_EVENT_DELETE:
+        for (size_t i = 0; i < g_adaptive_refresh_contexts.size(); ++i)
+        {
+            if (context == g_adaptive_refresh_contexts[i])
+            {
+                g_adaptive_refresh_contexts.erase(
+                    g_adaptive_refresh_contexts.begin() + i);
+                break;
+            }
+        }
+        delete context;
+        break;
+    default:
+        break;
+    }
+}
+
+static void lv_adaptive_refresh_indev_event_callback(
+    lv_event_t* e)
+{
+    lv_adaptive_refresh_context_t* context =
+        lv_adaptive_refresh_find_context(
+            static_cast<lv_display_t*>(lv_event_get_user_data(e)));
+    if (context)
+    {
+        lv_adaptive_refresh_activity(context);
+    }
+}
+
+bool lv_adaptive_refresh_attach_display(
+    lv_display_t* display,
+    uint32_t max_period)
+{
+    if (!display || lv_adaptive_refresh_find_context(display))
+    {
+        return false;
+    }
+
+    lv_adaptive_refresh_context_t* context =
+        new lv_adaptive_refresh_context_t();
+    context->display = display;
+    context->max_period = LV_MAX(
+        max_period ? max_period : LV_ADAPTIVE_REFRESH_MAX_PERIOD,
+        static_cast<uint32_t>(LV_DEF_REFR_PERIOD));
+    context->period = LV_DEF_REFR_PERIOD;
+    g_adaptive_refresh_contexts.push_back(context);
+
+    static const lv_event_code_t event_codes[] =
+    {
+        LV_EVENT_INVALIDATE_AREA,
+        LV_EVENT_REFR_READY,
+        LV_EVENT_DELETE
+    };
+    for (lv_event_code_t event_code : event_codes)
+    {
+        lv_display_add_event_cb(
+            display,
+            lv_adaptive_refresh_display_event_callback,
+            event_code,
+            context);
+    }
+
+    // The input which doesn't invalidate anything still snaps the refresh
+    // period back, so the following reaction isn't delayed by the idle
+    // period. The display instead of the context is passed, because the
+    // input devices may outlive the display.
+    for (lv_indev_t* indev = lv_indev_get_next(NULL);
+        indev;
+        indev = lv_indev_get_next(indev))
+    {
+        if (display == lv_indev_get_display(indev))
+        {
+            lv_indev_add_event_cb(
+                indev,
+                lv_adaptive_refresh_indev_event_callback,
+                LV_EVENT_PRESSED,
+                display);
+        }
+    }
+
+    return true;
+}
+
+bool lv_adaptive_refresh_get_stats(
+    lv_display_t* display,
+    lv_adaptive_refresh_stats_t* stats)
+{
+    if (!stats)
+    {
+        return false;
+    }
+
+    lv_adaptive_refresh_context_t* context =
+        lv_adaptive_refresh_find_context(display);
+    if (!context)
+    {
+        return false;
+    }
+
+    stats->period = context->period;
+    stats->idle_level = context->idle_level;
+    stats->snap_back_count = context->snap_back_count;
+
+    return true;
+}
+
+void lv_adaptive_refresh_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data)
+{
+    lv_adaptive_refresh_stats_t stats;
+    if (!buffer
+        || !buffer_size
+        || !lv_adaptive_refresh_get_stats(
+            static_cast<lv_display_t*>(user_data),
+            &stats))
+    {
+        return;
+    }
+
+    std::snprintf(
+        buffer,
+        buffer_size,
+        "%u ms refresh period, %u idle refreshes, %llu snap backs",
+        stats.period,
+        stats.idle_level,
+        static_cast<unsigned long long>(stats.snap_back_count));
+}
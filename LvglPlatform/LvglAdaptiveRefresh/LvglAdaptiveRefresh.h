@@ -0,0 +1,86 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglAdaptiveRefresh.h
+ * PURPOSE:   Definition for the adaptive refresh period of LVGL displays
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#ifndef LVGL_ADAPTIVE_REFRESH_H
+#define LVGL_ADAPTIVE_REFRESH_H
+
+#include "lvgl/lvgl.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The default maximum refresh period in milliseconds of the idle
+ *        displays.
+ */
+#ifndef LV_ADAPTIVE_REFRESH_MAX_PERIOD
+#define LV_ADAPTIVE_REFRESH_MAX_PERIOD 1000
+#endif
+
+typedef struct _lv_adaptive_refresh_stats_t
+{
+    // The current refresh period in milliseconds.
+    uint32_t period;
+    // The number of consecutive idle refreshes, each of which doubled the
+    // refresh period until reaching the maximum.
+    uint32_t idle_level;
+    // The number of times the refresh period was reset to the full rate.
+    uint64_t snap_back_count;
+} lv_adaptive_refresh_stats_t;
+
+/**
+ * @brief Doubles the refresh period of the display after every refresh
+ *        without any invalidation, running animation or input, and resets it
+ *        to LV_DEF_REFR_PERIOD on the first invalidation or input. The
+ *        invalidations inside the overlays on the system layer, e.g. the
+ *        sysmon, are ignored.
+ * @param display The display.
+ * @param max_period The maximum refresh period in milliseconds. 0 means
+ *                   LV_ADAPTIVE_REFRESH_MAX_PERIOD.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark If the display is attached to the frame scheduler, the minimum
+ *         refresh period of the scheduler is adjusted instead of the period
+ *         of the refresh timer, so the refreshes stay aligned to the vsyncs.
+ */
+bool lv_adaptive_refresh_attach_display(
+    lv_display_t* display,
+    uint32_t max_period);
+
+/**
+ * @brief Gets the statistics of the adaptive refresh period of the display.
+ * @param display The display.
+ * @param stats The statistics.
+ * @return If succeed, return true. Otherwise, return false.
+ */
+bool lv_adaptive_refresh_get_stats(
+    lv_display_t* display,
+    lv_adaptive_refresh_stats_t* stats);
+
+/**
+ * @brief Formats the statistics of the adaptive refresh period of a display
+ *        as a single line of text, which can be used as the callback of
+ *        lv_stats_monitor_add_source.
+ * @param buffer The buffer which receives the formatted statistics.
+ * @param buffer_size The size of the buffer in bytes.
+ * @param user_data The display.
+ */
+void lv_adaptive_refresh_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !LVGL_ADAPTIVE_REFRESH_H */
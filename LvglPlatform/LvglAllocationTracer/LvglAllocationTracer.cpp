@@ -0,0 +1,648 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglAllocationTracer.cpp
+ * PURPOSE:   Implementation for the allocation tracer of LVGL
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglAllocationTracer.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <DbgHelp.h>
+#elif defined(__GLIBC__)
+#include <dlfcn.h>
+#include <execinfo.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+typedef struct _lv_allocation_tracer_record_t
+{
+    // 0 means the record is unused.
+    uint64_t sequence;
+    void* pointer;
+    size_t size;
+    uint32_t frame;
+    // UINT32_MAX means the block is still live.
+    uint32_t free_frame;
+    uint64_t alloc_time;
+    uint64_t free_time;
+    void* frames[LV_ALLOCATION_TRACER_DEPTH];
+} lv_allocation_tracer_record_t;
+
+static struct
+{
+    std::atomic<bool> active;
+    std::atomic<uint32_t> frame;
+    std::mutex mutex;
+    std::vector<lv_allocation_tracer_record_t> records;
+    uint64_t recorded_count;
+    // The sequence of the record of every live block.
+    std::unordered_map<void*, uint64_t> live_records;
+} g_tracer;
+
+static const char* const g_tracer_subsystems[] =
+{
+    "draw",
+    "layout",
+    "label",
+    "style",
+    "image",
+    "animation",
+    "timer",
+    "event",
+    "object",
+    "refresh",
+    "application",
+    "other"
+};
+
+#define LV_ALLOCATION_TRACER_SUBSYSTEM_COUNT \
+    (sizeof(g_tracer_subsystems) / sizeof(*g_tracer_subsystems))
+#define LV_ALLOCATION_TRACER_SUBSYSTEM_OTHER \
+    (LV_ALLOCATION_TRACER_SUBSYSTEM_COUNT - 1)
+
+// The allocation is attributed to the innermost function in its backtrace
+// which matches one of the prefixes. The generic helpers like lv_malloc,
+// lv_ll_* and lv_array_* match none of them, so they are skipped. The more
+// specific prefixes need to be checked first.
+static const struct
+{
+    const char* prefix;
+    size_t subsystem;
+} g_tracer_prefixes[] =
+{
+    { "lv_draw_", 0 },
+    { "lv_parallel_draw_", 0 },
+    { "lv_shadow_cache_", 0 },
+    { "lv_circle_cache_", 0 },
+    { "lv_obj_update_layout", 1 },
+    { "lv_layout_", 1 },
+    { "lv_flex_", 1 },
+    { "lv_grid_", 1 },
+    { "lv_label_", 2 },
+    { "lv_text_", 2 },
+    { "lv_font_", 2 },
+    { "lv_bidi_", 2 },
+    { "lv_style_", 3 },
+    { "lv_obj_add_style", 3 },
+    { "lv_obj_remove_style", 3 },
+    { "lv_obj_set_local_style", 3 },
+    { "lv_obj_refresh_style", 3 },
+    { "lv_theme_", 3 },
+    { "lv_image_", 4 },
+    { "lv_cache_", 4 },
+    { "lv_bin_decoder_", 4 },
+    { "lv_anim_", 5 },
+    { "lv_timer_", 6 },
+    { "lv_event_", 7 },
+    { "lv_obj_send_event", 7 },
+    { "lv_obj_", 8 },
+    { "lv_refr_", 9 },
+    { "lv_inv_area", 9 },
+    { "lv_display_", 9 },
+    { "lv_demo_", 10 },
+    { "main", 10 },
+};
+
+static uint64_t lv_allocation_tracer_get_time()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+bool lv_allocation_tracer_start(
+    size_t capacity)
+{
+    if (!capacity)
+    {
+        capacity = LV_ALLOCATION_TRACER_CAPACITY;
+    }
+
+    std::lock_guard<std::mutex> lock(g_tracer.mutex);
+
+    try
+    {
+        g_tracer.records.assign(capacity, lv_allocation_tracer_record_t());
+        g_tracer.live_records.clear();
+        g_tracer.live_records.reserve(capacity);
+    }
+    catch (...)
+    {
+        g_tracer.records.clear();
+        return false;
+    }
+    g_tracer.recorded_count = 0;
+    g_tracer.frame.store(0, std::memory_order_relaxed);
+    g_tracer.active.store(true, std::memory_order_release);
+
+    return true;
+}
+
+void lv_allocation_tracer_stop(void)
+{
+    g_tracer.active.store(false, std::memory_order_release);
+}
+
+static void lv_allocation_tracer_display_event_callback(
+    lv_event_t* e)
+{
+    LV_UNUSED(e);
+
+    // The frames are only counted while tracing, so the frame counter spans
+    // the traced frames, including the ones without any allocation.
+    if (g_tracer.active.load(std::memory_order_acquire))
+    {
+        g_tracer.frame.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+bool lv_allocation_tracer_attach_display(
+    lv_display_t* display)
+{
+    if (!display)
+    {
+        return false;
+    }
+
+    lv_display_add_event_cb(
+        display,
+        lv_allocation_tracer_display_event_callback,
+        LV_EVENT_REFR_READY,
+        NULL);
+
+    return true;
+}
+
+void lv_allocation_tracer_record_alloc(
+    void* p,
+    size_t size)
+{
+    if (!p || !g_tracer.active.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    // Skip this function and the allocator backend, so the first frame is
+    // the allocation function of LVGL called.
+    void* frames[LV_ALLOCATION_TRACER_DEPTH + 2] = {};
+#ifdef _WIN32
+    ::RtlCaptureStackBackTrace(
+        2,
+        LV_ALLOCATION_TRACER_DEPTH,
+        frames + 2,
+        NULL);
+#elif defined(__GLIBC__)
+    ::backtrace(frames, LV_ALLOCATION_TRACER_DEPTH + 2);
+#endif
+    uint64_t alloc_time = lv_allocation_tracer_get_time();
+
+    std::lock_guard<std::mutex> lock(g_tracer.mutex);
+
+    if (g_tracer.records.empty())
+    {
+        return;
+    }
+
+    uint64_t sequence = ++g_tracer.recorded_count;
+    lv_allocation_tracer_record_t& record =
+        g_tracer.records[sequence % g_tracer.records.size()];
+
+    // The overwritten record can't be found by its block anymore.
+    if (record.sequence && UINT32_MAX == record.free_frame)
+    {
+        auto iterator = g_tracer.live_records.find(record.pointer);
+        if (g_tracer.live_records.end() != iterator &&
+            iterator->second == record.sequence)
+        {
+            g_tracer.live_records.erase(iterator);
+        }
+    }
+
+    record.sequence = sequence;
+    record.pointer = p;
+    record.size = size;
+    record.frame = g_tracer.frame.load(std::memory_order_relaxed);
+    record.free_frame = UINT32_MAX;
+    record.alloc_time = alloc_time;
+    record.free_time = 0;
+    std::memcpy(record.frames, frames + 2, sizeof(record.frames));
+
+    g_tracer.live_records[p] = sequence;
+}
+
+void lv_allocation_tracer_record_free(
+    void* p)
+{
+    if (!p || !g_tracer.active.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    uint64_t free_time = lv_allocation_tracer_get_time();
+
+    std::lock_guard<std::mutex> lock(g_tracer.mutex);
+
+    auto iterator = g_tracer.live_records.find(p);
+    if (g_tracer.live_records.end() == iterator)
+    {
+        return;
+    }
+
+    lv_allocation_tracer_record_t& record =
+        g_tracer.records[iterator->second % g_tracer.records.size()];
+    if (record.sequence == iterator->second)
+    {
+        record.free_frame = g_tracer.frame.load(std::memory_order_relaxed);
+        record.free_time = free_time;
+    }
+    g_tracer.live_records.erase(iterator);
+}
+
+static std::string lv_allocation_tracer_resolve(
+    void* address)
+{
+#ifdef _WIN32
+    // Load DbgHelp on demand, so the projects needn't link it.
+    typedef BOOL(WINAPI* SymInitializeType)(HANDLE, PCSTR, BOOL);
+    typedef BOOL(WINAPI* SymFromAddrType)(
+        HANDLE,
+        DWORD64,
+        PDWORD64,
+        PSYMBOL_INFO);
+    static SymFromAddrType sym_from_addr = []() -> SymFromAddrType
+    {
+        HMODULE module_handle = ::LoadLibraryW(L"dbghelp.dll");
+        if (!module_handle)
+        {
+            return NULL;
+        }
+        SymInitializeType sym_initialize =
+            reinterpret_cast<SymInitializeType>(
+                ::GetProcAddress(module_handle, "SymInitialize"));
+        if (!sym_initialize ||
+            !sym_initialize(::GetCurrentProcess(), NULL, TRUE))
+        {
+            return NULL;
+        }
+        return reinterpret_cast<SymFromAddrType>(
+            ::GetProcAddress(module_handle, "SymFromAddr"));
+    }();
+    if (!sym_from_addr)
+    {
+        return std::string();
+    }
+
+    uint8_t buffer[sizeof(SYMBOL_INFO) + MAX_SYM_NAME];
+    PSYMBOL_INFO symbol = reinterpret_cast<PSYMBOL_INFO>(buffer);
+    std::memset(symbol, 0, sizeof(SYMBOL_INFO));
+    symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+    symbol->MaxNameLen = MAX_SYM_NAME;
+    if (!sym_from_addr(
+        ::GetCurrentProcess(),
+        reinterpret_cast<DWORD64>(address),
+        NULL,
+        symbol))
+    {
+        return std::string();
+    }
+    return std::string(symbol->Name);
+#elif defined(__GLIBC__)
+    Dl_info info;
+    if (!::dladdr(address, &info) || !info.dli_sname)
+    {
+        return std::string();
+    }
+    return std::string(info.dli_sname);
+#else
+    LV_UNUSED(address);
+    return std::string();
+#endif
+}
+
+typedef struct _lv_allocation_tracer_summary_t
+{
+    uint64_t allocation_count;
+    uint64_t allocation_size;
+    // The blocks freed in the frame they are allocated, which are the
+    // candidates of the pools and the frame arena.
+    uint64_t freed_in_frame_count;
+    uint64_t freed_count;
+    uint64_t lifetime;
+} lv_allocation_tracer_summary_t;
+
+static void lv_allocation_tracer_add_record(
+    lv_allocation_tracer_summary_t& summary,
+    const lv_allocation_tracer_record_t& record)
+{
+    ++summary.allocation_count;
+    summary.allocation_size += record.size;
+    if (UINT32_MAX != record.free_frame)
+    {
+        ++summary.freed_count;
+        summary.lifetime += record.free_time - record.alloc_time;
+        if (record.free_frame == record.frame)
+        {
+            ++summary.freed_in_frame_count;
+        }
+    }
+}
+
+static void lv_allocation_tracer_write_string(
+    std::FILE* file,
+    const std::string& value)
+{
+    std::fputc('"', file);
+    for (char character : value)
+    {
+        if ('"' == character || '\\' == character)
+        {
+            std::fputc('\\', file);
+        }
+        std::fputc(character, file);
+    }
+    std::fputc('"', file);
+}
+
+// The averages per frame are omitted if the frame count is 0.
+static void lv_allocation_tracer_write_summary_fields(
+    std::FILE* file,
+    const lv_allocation_tracer_summary_t& summary,
+    size_t frame_count)
+{
+    std::fprintf(
+        file,
+        "\"allocations\": %llu, \"bytes\": %llu, ",
+        static_cast<unsigned long long>(summary.allocation_count),
+        static_cast<unsigned long long>(summary.allocation_size));
+    if (frame_count)
+    {
+        std::fprintf(
+            file,
+            "\"allocations_per_frame\": %.1f, \"bytes_per_frame\": %.1f, ",
+            static_cast<double>(summary.allocation_count) / frame_count,
+            static_cast<double>(summary.allocation_size) / frame_count);
+    }
+    std::fprintf(
+        file,
+        "\"freed_in_frame\": %llu, \"avg_lifetime_us\": %.1f",
+        static_cast<unsigned long long>(summary.freed_in_frame_count),
+        summary.freed_count
+            ? summary.lifetime / 1e3 / summary.freed_count
+            : 0.0);
+}
+
+bool lv_allocation_tracer_write_summary(
+    const char* file_path)
+{
+    if (!file_path)
+    {
+        return false;
+    }
+
+    std::vector<lv_allocation_tracer_record_t> records;
+    uint64_t recorded_count = 0;
+    uint32_t last_frame = 0;
+    {
+        std::lock_guard<std::mutex> lock(g_tracer.mutex);
+        records = g_tracer.records;
+        recorded_count = g_tracer.recorded_count;
+        last_frame = g_tracer.frame.load(std::memory_order_relaxed);
+    }
+    records.erase(
+        std::remove_if(
+            records.begin(),
+            records.end(),
+            [](const lv_allocation_tracer_record_t& record)
+    {
+        return !record.sequence;
+    }),
+        records.end());
+    if (records.empty())
+    {
+        return false;
+    }
+
+    // The oldest frame is incomplete if some of its records are overwritten.
+    uint32_t first_frame = 0;
+    if (recorded_count > records.size())
+    {
+        uint32_t oldest_frame = std::min_element(
+            records.begin(),
+            records.end(),
+            [](
+                const lv_allocation_tracer_record_t& left,
+                const lv_allocation_tracer_record_t& right)
+        {
+            return left.sequence < right.sequence;
+        })->frame;
+        records.erase(
+            std::remove_if(
+                records.begin(),
+                records.end(),
+                [oldest_frame](const lv_allocation_tracer_record_t& record)
+        {
+            return record.frame == oldest_frame;
+        }),
+            records.end());
+        first_frame = oldest_frame + 1;
+    }
+
+    struct frame_summary_t
+    {
+        lv_allocation_tracer_summary_t summary;
+        uint64_t subsystem_counts[LV_ALLOCATION_TRACER_SUBSYSTEM_COUNT];
+    };
+    struct function_summary_t
+    {
+        lv_allocation_tracer_summary_t summary;
+        size_t subsystem;
+    };
+    std::map<uint32_t, frame_summary_t> frames;
+    lv_allocation_tracer_summary_t subsystems[
+        LV_ALLOCATION_TRACER_SUBSYSTEM_COUNT] = {};
+    std::map<std::string, function_summary_t> functions;
+    std::unordered_map<void*, std::string> symbols;
+
+    for (const lv_allocation_tracer_record_t& record : records)
+    {
+        size_t subsystem = LV_ALLOCATION_TRACER_SUBSYSTEM_OTHER;
+        const std::string* function = NULL;
+        for (void* address : record.frames)
+        {
+            if (!address)
+            {
+                break;
+            }
+
+            auto symbol = symbols.find(address);
+            if (symbols.end() == symbol)
+            {
+                symbol = symbols.emplace(
+                    address,
+                    lv_allocation_tracer_resolve(address)).first;
+            }
+
+            for (const auto& prefix : g_tracer_prefixes)
+            {
+                if (0 == symbol->second.compare(
+                    0,
+                    std::strlen(prefix.prefix),
+                    prefix.prefix))
+                {
+                    subsystem = prefix.subsystem;
+                    function = &symbol->second;
+                    break;
+                }
+            }
+            if (function)
+            {
+                break;
+            }
+        }
+
+        frame_summary_t& frame = frames[record.frame];
+        lv_allocation_tracer_add_record(frame.summary, record);
+        ++frame.subsystem_counts[subsystem];
+
+        lv_allocation_tracer_add_record(subsystems[subsystem], record);
+
+        if (function)
+        {
+            function_summary_t& function_summary = functions[*function];
+            lv_allocation_tracer_add_record(function_summary.summary, record);
+            function_summary.subsystem = subsystem;
+        }
+    }
+
+    std::vector<std::pair<std::string, function_summary_t>> top_functions(
+        functions.begin(),
+        functions.end());
+    std::sort(
+        top_functions.begin(),
+        top_functions.end(),
+        [](
+            const std::pair<std::string, function_summary_t>& left,
+            const std::pair<std::string, function_summary_t>& right)
+    {
+        return left.second.summary.allocation_count
+            > right.second.summary.allocation_count;
+    });
+    if (top_functions.size() > 32)
+    {
+        top_functions.resize(32);
+    }
+
+    std::FILE* file = std::fopen(file_path, "w");
+    if (!file)
+    {
+        return false;
+    }
+
+    // The frames without any allocation are not in the map, but still count
+    // for the averages per frame.
+    const size_t frame_count = last_frame >= first_frame
+        ? static_cast<size_t>(last_frame - first_frame) + 1
+        : 0;
+    std::fprintf(
+        file,
+        "{\n"
+        "  \"recorded\": %llu,\n"
+        "  \"kept\": %zu,\n"
+        "  \"frames\": [",
+        static_cast<unsigned long long>(recorded_count),
+        records.size());
+
+    bool first = true;
+    for (const auto& frame : frames)
+    {
+        std::fprintf(
+            file,
+            "%s\n    { \"frame\": %u, ",
+            first ? "" : ",",
+            frame.first);
+        lv_allocation_tracer_write_summary_fields(
+            file,
+            frame.second.summary,
+            0);
+        std::fprintf(file, ", \"subsystems\": {");
+        bool first_subsystem = true;
+        for (size_t i = 0; i < LV_ALLOCATION_TRACER_SUBSYSTEM_COUNT; ++i)
+        {
+            if (frame.second.subsystem_counts[i])
+            {
+                std::fprintf(
+                    file,
+                    "%s\"%s\": %llu",
+                    first_subsystem ? " " : ", ",
+                    g_tracer_subsystems[i],
+                    static_cast<unsigned long long>(
+                        frame.second.subsystem_counts[i]));
+                first_subsystem = false;
+            }
+        }
+        std::fprintf(file, " } }");
+        first = false;
+    }
+
+    std::fprintf(file, "\n  ],\n  \"subsystems\": [");
+    first = true;
+    for (size_t i = 0; i < LV_ALLOCATION_TRACER_SUBSYSTEM_COUNT; ++i)
+    {
+        if (!subsystems[i].allocation_count)
+        {
+            continue;
+        }
+
+        std::fprintf(
+            file,
+            "%s\n    { \"subsystem\": \"%s\", ",
+            first ? "" : ",",
+            g_tracer_subsystems[i]);
+        lv_allocation_tracer_write_summary_fields(
+            file,
+            subsystems[i],
+            frame_count);
+        std::fprintf(file, " }");
+        first = false;
+    }
+
+    std::fprintf(file, "\n  ],\n  \"functions\": [");
+    first = true;
+    for (const auto& function : top_functions)
+    {
+        std::fprintf(file, "%s\n    { \"function\": ", first ? "" : ",");
+        lv_allocation_tracer_write_string(file, function.first);
+        std::fprintf(
+            file,
+            ", \"subsystem\": \"%s\", ",
+            g_tracer_subsystems[function.second.subsystem]);
+        lv_allocation_tracer_write_summary_fields(
+            file,
+            function.second.summary,
+            frame_count);
+        std::fprintf(file, " }");
+        first = false;
+    }
+
+    std::fprintf(file, "\n  ]\n}\n");
+
+    bool succeeded = !std::ferror(file);
+    succeeded = (0 == std::fclose(file)) && succeeded;
+    return succeeded;
+}
@@ -0,0 +1,101 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglAllocationTracer.h
+ * PURPOSE:   Definition for the allocation tracer of LVGL
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#ifndef LVGL_ALLOCATION_TRACER_H
+#define LVGL_ALLOCATION_TRACER_H
+
+#include "lvgl/lvgl.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The default number of the allocations kept in the ring buffer of the
+ *        tracer. The oldest allocations are overwritten when it is full.
+ */
+#ifndef LV_ALLOCATION_TRACER_CAPACITY
+#define LV_ALLOCATION_TRACER_CAPACITY (64 * 1024)
+#endif
+
+/**
+ * @brief The number of the return addresses recorded for every allocation,
+ *        which are used for attributing the allocation to a subsystem.
+ */
+#define LV_ALLOCATION_TRACER_DEPTH 8
+
+/**
+ * @brief Starts recording every allocation of LVGL into the ring buffer.
+ * @param capacity The number of the allocations kept in the ring buffer. 0
+ *                 means LV_ALLOCATION_TRACER_CAPACITY.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark The allocations are only recorded if LV_USE_STDLIB_MALLOC is set to
+ *         LV_STDLIB_CUSTOM, which is implemented by LvglSlabAllocator. The
+ *         records of the previous run are discarded.
+ */
+bool lv_allocation_tracer_start(
+    size_t capacity);
+
+/**
+ * @brief Stops recording the allocations. The records are kept for
+ *        lv_allocation_tracer_write_summary.
+ */
+void lv_allocation_tracer_stop(void);
+
+/**
+ * @brief Counts the frames of the display, which are used for grouping the
+ *        allocations. The allocations made before LV_EVENT_REFR_READY of the
+ *        display belong to the frame being rendered. The frames are only
+ *        counted while the tracer is started.
+ * @param display The display.
+ * @return If succeed, return true. Otherwise, return false.
+ */
+bool lv_allocation_tracer_attach_display(
+    lv_display_t* display);
+
+/**
+ * @brief Records an allocation. It is called by the allocator backend.
+ * @param p The allocated block.
+ * @param size The requested size in bytes of the block.
+ */
+void lv_allocation_tracer_record_alloc(
+    void* p,
+    size_t size);
+
+/**
+ * @brief Records the release of an allocation. It is called by the allocator
+ *        backend.
+ * @param p The block being freed.
+ */
+void lv_allocation_tracer_record_free(
+    void* p);
+
+/**
+ * @brief Writes the allocations in the ring buffer summarized per frame, per
+ *        subsystem and per LVGL function to the specified JSON file.
+ * @param file_path The path of the JSON file.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark The subsystem of an allocation is decided by the names of the LVGL
+ *         functions in its backtrace. On POSIX hosts, the functions are only
+ *         resolved if the executable exports its symbols, e.g. via -rdynamic,
+ *         and the static functions are reported as the nearest exported one.
+ *         On Windows, the functions are resolved via DbgHelp, which needs the
+ *         PDB file of the executable.
+ */
+bool lv_allocation_tracer_write_summary(
+    const char* file_path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !LVGL_ALLOCATION_TRACER_H */
@@ -0,0 +1,416 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglBenchmarkRunner.cpp
+ * PURPOSE:   Implementation for the scripted LVGL benchmark runner
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglBenchmarkRunner.h"
+
+#include <LvglFrameTiming.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+typedef struct _lv_benchmark_runner_scene_t
+{
+    uint32_t start_tick;
+    uint64_t start_time;
+    uint32_t rendered_frame_count;
+    uint32_t frame_count;
+    uint64_t refr_time_sum;
+    uint64_t render_time_sum;
+    uint64_t flush_time_sum;
+    uint64_t refr_time_max;
+    size_t peak_memory;
+} lv_benchmark_runner_scene_t;
+
+typedef struct _lv_benchmark_runner_scene_result_t
+{
+    std::string scene;
+    uint32_t frame_count;
+    uint32_t refr_avg_time;
+    uint32_t render_avg_time;
+    uint32_t flush_avg_time;
+    uint32_t refr_max_time;
+    uint32_t fps;
+    uint32_t max_fps;
+    uint32_t cpu;
+    size_t peak_memory;
+} lv_benchmark_runner_scene_result_t;
+
+static struct
+{
+    lv_display_t* display;
+    lv_obj_t* screen;
+    uint32_t frame_limit;
+    uint32_t scene_timeout;
+    bool finished;
+    uint32_t finished_tick;
+    uint64_t finished_time;
+    lv_frame_timing_t timing;
+    std::vector<lv_benchmark_runner_scene_t> scenes;
+    std::vector<std::string> scene_names;
+} g_runner;
+
+// The scenes of lv_demo_benchmark in LVGL v9, in the order they are shown.
+// The "Empty screen" scene is not listed, because it only animates the screen
+// without creating any child, so it is never detected as a scene.
+static const char* const g_demo_benchmark_scene_names[] =
+{
+    "Moving wallpaper",
+    "Single rectangle",
+    "Multiple rectangles",
+    "Multiple RGB images",
+    "Multiple ARGB images",
+    "Rotated ARGB images",
+    "Multiple labels",
+    "Screen sized text",
+    "Multiple arcs",
+    "Containers",
+    "Containers with overlay",
+    "Containers with opa",
+    "Containers with opa_layer",
+    "Containers with scrolling",
+    "Widgets demo",
+};
+
+static size_t lv_benchmark_runner_get_used_memory()
+{
+    lv_mem_monitor_t monitor;
+    std::memset(&monitor, 0, sizeof(monitor));
+    lv_mem_monitor(&monitor);
+    return monitor.total_size - monitor.free_size;
+}
+
+static void lv_benchmark_runner_frame_finished(
+    const lv_frame_timing_frame_t* frame)
+{
+    if (g_runner.scenes.empty())
+    {
+        return;
+    }
+
+    lv_benchmark_runner_scene_t& scene = g_runner.scenes.back();
+
+    if (lv_tick_elaps(scene.start_tick) > g_runner.scene_timeout)
+    {
+        // No new scene is loaded for a long time, so the current scene is the
+        // summary screen shown when lv_demo_benchmark is finished.
+        g_runner.finished_tick = scene.start_tick;
+        g_runner.finished_time = scene.start_time;
+        g_runner.scenes.pop_back();
+        g_runner.finished = true;
+        return;
+    }
+
+    if (!frame)
+    {
+        return;
+    }
+
+    // The first frame of each scene contains the cost of loading the scene,
+    // which is also ignored by lv_demo_benchmark itself.
+    if (!scene.rendered_frame_count++)
+    {
+        return;
+    }
+
+    if (g_runner.frame_limit && scene.frame_count >= g_runner.frame_limit)
+    {
+        return;
+    }
+
+    ++scene.frame_count;
+    scene.refr_time_sum += frame->refr_time;
+    scene.render_time_sum += frame->render_time;
+    scene.flush_time_sum += frame->flush_time;
+    scene.refr_time_max = LV_MAX(scene.refr_time_max, frame->refr_time);
+    scene.peak_memory = LV_MAX(
+        scene.peak_memory,
+        lv_benchmark_runner_get_used_memory());
+}
+
+static void lv_benchmark_runner_display_event_callback(
+    lv_event_t* e)
+{
+    if (g_runner.finished)
+    {
+        return;
+    }
+
+    lv_event_code_t code = lv_event_get_code(e);
+
+    if (LV_EVENT_DELETE == code)
+    {
+        g_runner.finished_tick = lv_tick_get();
+        g_runner.finished_time = lv_frame_timing_get_time();
+        g_runner.finished = true;
+        return;
+    }
+
+    lv_frame_timing_frame_t frame;
+    bool rendered = lv_frame_timing_handle_event(
+        &g_runner.timing,
+        code,
+        &frame);
+    if (LV_EVENT_REFR_READY == code)
+    {
+        lv_benchmark_runner_frame_finished(rendered ? &frame : NULL);
+    }
+}
+
+static void lv_benchmark_runner_screen_event_callback(
+    lv_event_t* e)
+{
+    if (g_runner.finished)
+    {
+        return;
+    }
+
+    if (1 != lv_obj_get_child_count(g_runner.screen))
+    {
+        return;
+    }
+
+    lv_benchmark_runner_scene_t scene;
+    std::memset(&scene, 0, sizeof(scene));
+    scene.start_tick = lv_tick_get();
+    scene.start_time = lv_frame_timing_get_time();
+    g_runner.scenes.push_back(scene);
+
+    LV_UNUSED(e);
+}
+
+static bool lv_benchmark_runner_get_scene_result(
+    size_t index,
+    lv_benchmark_runner_scene_result_t* result)
+{
+    const lv_benchmark_runner_scene_t& scene = g_runner.scenes[index];
+    if (!scene.frame_count)
+    {
+        return false;
+    }
+
+    // The tick may be driven by the synthetic clock of the headless display,
+    // so the wall-clock time is used for the ratios to the measured time.
+    uint64_t end_time = index + 1 < g_runner.scenes.size()
+        ? g_runner.scenes[index + 1].start_time
+        : (g_runner.finished
+            ? g_runner.finished_time
+            : lv_frame_timing_get_time());
+    uint64_t elapsed = end_time - scene.start_time;
+    elapsed = LV_MAX(elapsed, 1ULL);
+
+    if (index < g_runner.scene_names.size())
+    {
+        result->scene = g_runner.scene_names[index];
+    }
+    else
+    {
+        result->scene = "Scene " + std::to_string(index);
+    }
+    result->frame_count = scene.frame_count;
+    result->refr_avg_time = static_cast<uint32_t>(
+        scene.refr_time_sum / scene.frame_count);
+    result->render_avg_time = static_cast<uint32_t>(
+        scene.render_time_sum / scene.frame_count);
+    result->flush_avg_time = static_cast<uint32_t>(
+        scene.flush_time_sum / scene.frame_count);
+    result->refr_max_time = static_cast<uint32_t>(scene.refr_time_max);
+    result->fps = static_cast<uint32_t>(
+        scene.rendered_frame_count * 1000000ULL / elapsed);
+    result->max_fps = result->refr_avg_time
+        ? 1000000 / result->refr_avg_time
+        : 0;
+    // The time spent on refreshing the display in the scene, estimated from
+    // the measured frames, relative to the time of the scene.
+    result->cpu = static_cast<uint32_t>(LV_MIN(
+        100ULL,
+        static_cast<uint64_t>(result->refr_avg_time)
+        * scene.rendered_frame_count * 100 / elapsed));
+    result->peak_memory = scene.peak_memory;
+
+    return true;
+}
+
+bool lv_benchmark_runner_start(
+    lv_display_t* display,
+    uint32_t frame_count,
+    uint32_t scene_timeout)
+{
+    if (!display || g_runner.display)
+    {
+        return false;
+    }
+
+    g_runner.display = display;
+    g_runner.screen = lv_display_get_screen_active(display);
+    g_runner.frame_limit = frame_count;
+    g_runner.scene_timeout = scene_timeout;
+    g_runner.finished = false;
+    std::memset(&g_runner.timing, 0, sizeof(g_runner.timing));
+    g_runner.scenes.clear();
+    if (g_runner.scene_names.empty())
+    {
+        g_runner.scene_names.assign(
+            g_demo_benchmark_scene_names,
+            g_demo_benchmark_scene_names
+            + sizeof(g_demo_benchmark_scene_names)
+            / sizeof(*g_demo_benchmark_scene_names));
+    }
+
+    lv_display_add_event_cb(
+        display,
+        lv_benchmark_runner_display_event_callback,
+        LV_EVENT_ALL,
+        NULL);
+    lv_obj_add_event_cb(
+        g_runner.screen,
+        lv_benchmark_runner_screen_event_callback,
+        LV_EVENT_CHILD_CREATED,
+        NULL);
+
+    return true;
+}
+
+bool lv_benchmark_runner_set_scene_names(
+    const char* const* names,
+    size_t count)
+{
+    if (!names && count)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        // The names are written to the CSV files without quoting.
+        if (!names[i] || !names[i][0] || std::strpbrk(names[i], ",\"\n"))
+        {
+            return false;
+        }
+    }
+
+    g_runner.scene_names.assign(names, names + count);
+
+    return true;
+}
+
+bool lv_benchmark_runner_is_finished(void)
+{
+    return g_runner.finished;
+}
+
+bool lv_benchmark_runner_write_results(
+    const char* file_path)
+{
+    if (!file_path || g_runner.scenes.empty())
+    {
+        return false;
+    }
+
+    size_t file_path_length = std::strlen(file_path);
+    bool json_format =
+        file_path_length >= 5 &&
+        0 == std::strcmp(file_path + file_path_length - 5, ".json");
+
+    std::FILE* file = std::fopen(file_path, "w");
+    if (!file)
+    {
+        return false;
+    }
+
+    if (json_format)
+    {
+        std::fprintf(
+            file,
+            "{\n"
+            "  \"lvgl\": \"%d.%d.%d\",\n"
+            "  \"draw_units\": %d,\n"
+            "  \"scenes\": [",
+            LVGL_VERSION_MAJOR,
+            LVGL_VERSION_MINOR,
+            LVGL_VERSION_PATCH,
+            LV_DRAW_SW_DRAW_UNIT_CNT);
+    }
+    else
+    {
+        std::fprintf(
+            file,
+            "scene,frames,refr_avg_us,render_avg_us,flush_avg_us,"
+            "refr_max_us,fps,max_fps,cpu,peak_memory\n");
+    }
+
+    bool first = true;
+    for (size_t i = 0; i < g_runner.scenes.size(); ++i)
+    {
+        lv_benchmark_runner_scene_result_t result;
+        if (!lv_benchmark_runner_get_scene_result(i, &result))
+        {
+            continue;
+        }
+
+        if (json_format)
+        {
+            std::fprintf(
+                file,
+                "%s\n"
+                "    {\n"
+                "      \"scene\": \"%s\",\n"
+                "      \"frames\": %u,\n"
+                "      \"refr_avg_us\": %u,\n"
+                "      \"render_avg_us\": %u,\n"
+                "      \"flush_avg_us\": %u,\n"
+                "      \"refr_max_us\": %u,\n"
+                "      \"fps\": %u,\n"
+                "      \"max_fps\": %u,\n"
+                "      \"cpu\": %u,\n"
+                "      \"peak_memory\": %zu\n"
+                "    }",
+                first ? "" : ",",
+                result.scene.c_str(),
+                result.frame_count,
+                result.refr_avg_time,
+                result.render_avg_time,
+                result.flush_avg_time,
+                result.refr_max_time,
+                result.fps,
+                result.max_fps,
+                result.cpu,
+                result.peak_memory);
+        }
+        else
+        {
+            std::fprintf(
+                file,
+                "%s,%u,%u,%u,%u,%u,%u,%u,%u,%zu\n",
+                result.scene.c_str(),
+                result.frame_count,
+                result.refr_avg_time,
+                result.render_avg_time,
+                result.flush_avg_time,
+                result.refr_max_time,
+                result.fps,
+                result.max_fps,
+                result.cpu,
+                result.peak_memory);
+        }
+
+        first = false;
+    }
+
+    if (json_format)
+    {
+        std::fprintf(file, "\n  ]\n}\n");
+    }
+
+    bool succeeded = !std::ferror(file);
+    succeeded = (0 == std::fclose(file)) && succeeded;
+    return succeeded && !first;
+}
@@ -0,0 +1,74 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglBenchmarkRunner.h
+ * PURPOSE:   Definition for the scripted LVGL benchmark runner
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#ifndef LVGL_BENCHMARK_RUNNER_H
+#define LVGL_BENCHMARK_RUNNER_H
+
+#include "lvgl/lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Starts measuring the benchmark scenes rendered on a display.
+ * @param display The display which the benchmark is rendered on.
+ * @param frame_count The maximum number of frames measured for each scene
+ *                    after the warm-up frame. 0 means all frames.
+ * @param scene_timeout The time in milliseconds after which the current scene
+ *                      is considered as the summary of the benchmark, which
+ *                      means the benchmark is finished.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark This function should be called before lv_demo_benchmark. A new scene
+ *         is detected when the first child is created on the cleaned active
+ *         screen, which is what lv_demo_benchmark does for every scene.
+ */
+bool lv_benchmark_runner_start(
+    lv_display_t* display,
+    uint32_t frame_count,
+    uint32_t scene_timeout);
+
+/**
+ * @brief Sets the names of the scenes in the order they are shown, which are
+ *        used as the keys of the scenes in the result files. The names of
+ *        the lv_demo_benchmark scenes are used by default, and the scenes
+ *        beyond the names are named by their index.
+ * @param names The names of the scenes. They must not contain commas, double
+ *              quotes or line breaks.
+ * @param count The number of the names.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark The names are copied, and this function should be called before
+ *         lv_benchmark_runner_start.
+ */
+bool lv_benchmark_runner_set_scene_names(
+    const char* const* names,
+    size_t count);
+
+/**
+ * @brief Checks whether the benchmark is finished.
+ * @return If the benchmark is finished, return true. Otherwise, return false.
+ */
+bool lv_benchmark_runner_is_finished(void);
+
+/**
+ * @brief Writes the per-scene results of the benchmark to a file.
+ * @param file_path The path of the result file. The results are written in
+ *                  JSON if the file name ends with ".json", and in CSV
+ *                  otherwise.
+ * @return If succeed, return true. Otherwise, return false.
+ */
+bool lv_benchmark_runner_write_results(
+    const char* file_path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !LVGL_BENCHMARK_RUNNER_H */
@@ -0,0 +1,418 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglBenchmarkScenes.cpp
+ * PURPOSE:   Implementation for the platform specific LVGL benchmark scenes
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglBenchmarkScenes.h"
+#include "LvglStyleCache.h"
+
+#include "lvgl/demos/lv_demos.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#define LV_BENCHMARK_SCENES_IMAGE_COUNT 8
+#define LV_BENCHMARK_SCENES_IMAGE_SIZE 64
+#define LV_BENCHMARK_SCENES_IMAGE_GAP 8
+#define LV_BENCHMARK_SCENES_CHILDREN_PER_CONTAINER 100
+
+// The properties looked up by LVGL for every object in every frame when
+// drawing the main part, and the inherited text properties of the labels.
+static const lv_style_prop_t g_hot_style_props[] =
+{
+    LV_STYLE_BG_COLOR,
+    LV_STYLE_BG_OPA,
+    LV_STYLE_BORDER_WIDTH,
+    LV_STYLE_RADIUS,
+    LV_STYLE_PAD_TOP,
+    LV_STYLE_OPA,
+    LV_STYLE_TEXT_COLOR,
+    LV_STYLE_TEXT_FONT
+};
+
+static struct
+{
+    std::vector<uint8_t> image_data[LV_BENCHMARK_SCENES_IMAGE_COUNT];
+    lv_image_dsc_t images[LV_BENCHMARK_SCENES_IMAGE_COUNT];
+} g_scenes;
+
+static void lv_benchmark_scenes_create_images()
+{
+    const uint32_t palette_size = 256 * sizeof(lv_color32_t);
+    const uint32_t pixel_count =
+        LV_BENCHMARK_SCENES_IMAGE_SIZE * LV_BENCHMARK_SCENES_IMAGE_SIZE;
+
+    for (uint32_t i = 0; i < LV_BENCHMARK_SCENES_IMAGE_COUNT; ++i)
+    {
+        std::vector<uint8_t>& data = g_scenes.image_data[i];
+        if (!data.empty())
+        {
+            continue;
+        }
+
+        data.resize(palette_size + pixel_count);
+
+        // Every image has its own palette, so they are cached separately.
+        lv_color32_t* palette = reinterpret_cast<lv_color32_t*>(data.data());
+        for (uint32_t j = 0; j < 256; ++j)
+        {
+            palette[j].red = static_cast<uint8_t>(j + i * 32);
+            palette[j].green = static_cast<uint8_t>(255 - j);
+            palette[j].blue = static_cast<uint8_t>(j * (i + 1));
+            palette[j].alpha = 0xFF;
+        }
+
+        uint8_t* indices = data.data() + palette_size;
+        for (uint32_t y = 0; y < LV_BENCHMARK_SCENES_IMAGE_SIZE; ++y)
+        {
+            for (uint32_t x = 0; x < LV_BENCHMARK_SCENES_IMAGE_SIZE; ++x)
+            {
+                indices[y * LV_BENCHMARK_SCENES_IMAGE_SIZE + x] =
+                    static_cast<uint8_t>((x * 4) ^ (y * 4));
+            }
+        }
+
+        lv_image_dsc_t& image = g_scenes.images[i];
+        std::memset(&image, 0, sizeof(image));
+        image.header.magic = LV_IMAGE_HEADER_MAGIC;
+        image.header.cf = LV_COLOR_FORMAT_I8;
+        image.header.w = LV_BENCHMARK_SCENES_IMAGE_SIZE;
+        image.header.h = LV_BENCHMARK_SCENES_IMAGE_SIZE;
+        image.header.stride = LV_BENCHMARK_SCENES_IMAGE_SIZE;
+        image.data_size = static_cast<uint32_t>(data.size());
+        image.data = data.data();
+    }
+}
+
+static void lv_benchmark_scenes_set_x(
+    void* var,
+    int32_t value)
+{
+    lv_obj_set_x(static_cast<lv_obj_t*>(var), value);
+}
+
+static void lv_benchmark_scenes_finish_callback(
+    lv_timer_t* timer)
+{
+    LV_UNUSED(timer);
+
+    lv_obj_t* screen = lv_screen_active();
+    lv_obj_clean(screen);
+
+    lv_obj_t* label = lv_label_create(screen);
+    lv_label_set_text(label, "Benchmark scene finished");
+    lv_obj_center(label);
+}
+
+bool lv_benchmark_scenes_image_cache(
+    uint32_t duration)
+{
+    lv_benchmark_scenes_create_images();
+
+    lv_obj_t* screen = lv_screen_active();
+    lv_obj_clean(screen);
+
+    lv_obj_t* container = lv_obj_create(screen);
+    if (!container)
+    {
+        return false;
+    }
+    lv_obj_remove_style_all(container);
+    lv_obj_remove_flag(container, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_size(
+        container,
+        lv_obj_get_width(screen),
+        lv_obj_get_height(screen));
+
+    const int32_t cell_size =
+        LV_BENCHMARK_SCENES_IMAGE_SIZE + LV_BENCHMARK_SCENES_IMAGE_GAP;
+    const int32_t column_count =
+        LV_MAX(lv_obj_get_width(screen) / cell_size - 1, 1);
+    const int32_t row_count = LV_MAX(lv_obj_get_height(screen) / cell_size, 1);
+
+    for (int32_t row = 0; row < row_count; ++row)
+    {
+        for (int32_t column = 0; column < column_count; ++column)
+        {
+            lv_obj_t* image = lv_image_create(container);
+            if (!image)
+            {
+                return false;
+            }
+
+            uint32_t index = static_cast<uint32_t>(row * column_count + column);
+            lv_image_set_src(
+                image,
+                &g_scenes.images[index % LV_BENCHMARK_SCENES_IMAGE_COUNT]);
+            lv_obj_set_pos(image, column * cell_size, row * cell_size);
+        }
+    }
+
+    // Move the whole grid by one cell, so every image is drawn in every frame.
+    lv_anim_t animation;
+    lv_anim_init(&animation);
+    lv_anim_set_var(&animation, container);
+    lv_anim_set_exec_cb(&animation, lv_benchmark_scenes_set_x);
+    lv_anim_set_values(&animation, 0, cell_size);
+    lv_anim_set_duration(&animation, 1000);
+    lv_anim_set_reverse_duration(&animation, 1000);
+    lv_anim_set_repeat_count(&animation, LV_ANIM_REPEAT_INFINITE);
+    lv_anim_start(&animation);
+
+    lv_timer_t* timer = lv_timer_create(
+        lv_benchmark_scenes_finish_callback,
+        duration,
+        NULL);
+    if (!timer)
+    {
+        return false;
+    }
+    lv_timer_set_repeat_count(timer, 1);
+
+    return true;
+}
+
+static uint64_t lv_benchmark_scenes_get_time()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+static uint64_t lv_benchmark_scenes_measure_style_lookup(
+    const std::vector<lv_obj_t*>& objects,
+    uint32_t round_count,
+    bool cached,
+    bool state_changes)
+{
+    // Accumulate the values, so the lookups are not optimized out.
+    volatile int32_t sink = 0;
+
+    uint64_t elapsed = 0;
+    for (uint32_t round = 0; round < round_count; ++round)
+    {
+        if (state_changes)
+        {
+            for (size_t i = round % 100; i < objects.size(); i += 100)
+            {
+                if (lv_obj_has_state(objects[i], LV_STATE_CHECKED))
+                {
+                    lv_obj_remove_state(objects[i], LV_STATE_CHECKED);
+                }
+                else
+                {
+                    lv_obj_add_state(objects[i], LV_STATE_CHECKED);
+                }
+            }
+        }
+
+        uint64_t start_time = lv_benchmark_scenes_get_time();
+        for (lv_obj_t* object : objects)
+        {
+            for (lv_style_prop_t prop : g_hot_style_props)
+            {
+                lv_style_value_t value = cached
+                    ? lv_style_cache_get_prop(object, LV_PART_MAIN, prop)
+                    : lv_obj_get_style_prop(object, LV_PART_MAIN, prop);
+                sink = sink + value.num;
+            }
+        }
+        elapsed += lv_benchmark_scenes_get_time() - start_time;
+    }
+
+    return elapsed;
+}
+
+bool lv_benchmark_scenes_style_lookup(
+    uint32_t object_count,
+    uint32_t round_count)
+{
+    if (!object_count || !round_count)
+    {
+        return false;
+    }
+
+    lv_obj_t* screen = lv_screen_active();
+    lv_obj_clean(screen);
+
+    lv_obj_t* root = lv_obj_create(screen);
+    if (!root)
+    {
+        return false;
+    }
+
+    // Every container has a mix of plain objects, buttons and labels, which
+    // have the different style lists applied by the default theme.
+    std::vector<lv_obj_t*> objects;
+    objects.reserve(object_count);
+    lv_obj_t* container = NULL;
+    while (objects.size() < object_count)
+    {
+        if (0 == objects.size() % LV_BENCHMARK_SCENES_CHILDREN_PER_CONTAINER)
+        {
+            container = lv_obj_create(root);
+            if (!container)
+            {
+                lv_obj_delete(root);
+                return false;
+            }
+            objects.push_back(container);
+            continue;
+        }
+
+        lv_obj_t* object = NULL;
+        switch (objects.size() % 3)
+        {
+        case 0:
+            object = lv_obj_create(container);
+            break;
+        case 1:
+            object = lv_button_create(container);
+            break;
+        default:
+            object = lv_label_create(container);
+            break;
+        }
+        if (!object)
+        {
+            lv_obj_delete(root);
+            return false;
+        }
+        objects.push_back(object);
+    }
+
+    const uint64_t lookup_count = static_cast<uint64_t>(object_count)
+        * round_count
+        * (sizeof(g_hot_style_props) / sizeof(*g_hot_style_props));
+
+    uint64_t uncached_time = lv_benchmark_scenes_measure_style_lookup(
+        objects,
+        round_count,
+        false,
+        false);
+    uint64_t state_changes_time = lv_benchmark_scenes_measure_style_lookup(
+        objects,
+        round_count,
+        false,
+        true);
+    uint64_t cached_time = lv_benchmark_scenes_measure_style_lookup(
+        objects,
+        round_count,
+        true,
+        false);
+    uint64_t invalidated_time = lv_benchmark_scenes_measure_style_lookup(
+        objects,
+        round_count,
+        true,
+        true);
+
+    std::printf(
+        "Style lookup benchmark: %u objects, %u properties, %u rounds, "
+        "LV_OBJ_STYLE_CACHE %d\n",
+        object_count,
+        static_cast<uint32_t>(
+            sizeof(g_hot_style_props) / sizeof(*g_hot_style_props)),
+        round_count,
+        LV_OBJ_STYLE_CACHE);
+    std::printf("mode,ns_per_lookup,lookups_per_second\n");
+    const struct
+    {
+        const char* name;
+        uint64_t time;
+    } results[] =
+    {
+        { "lv_obj_get_style_prop", uncached_time },
+        { "lv_obj_get_style_prop_with_state_changes", state_changes_time },
+        { "lv_style_cache_get_prop", cached_time },
+        { "lv_style_cache_get_prop_with_state_changes", invalidated_time },
+    };
+    for (const auto& result : results)
+    {
+        std::printf(
+            "%s,%.2f,%.0f\n",
+            result.name,
+            static_cast<double>(result.time) / lookup_count,
+            result.time ? lookup_count * 1e9 / result.time : 0.0);
+    }
+
+    char stats[256];
+    stats[0] = '\0';
+    lv_style_cache_format_stats(stats, sizeof(stats), NULL);
+    std::printf("Style cache: %s\n", stats);
+
+    lv_obj_delete(root);
+
+    return true;
+}
+
+bool lv_benchmark_scenes_widgets_allocation(
+    uint32_t round_count)
+{
+#if LV_USE_DEMO_WIDGETS
+    if (!round_count)
+    {
+        return false;
+    }
+
+    lv_obj_clean(lv_screen_active());
+
+    uint64_t create_time = 0;
+    uint64_t render_time = 0;
+    uint64_t delete_time = 0;
+    for (uint32_t round = 0; round < round_count; ++round)
+    {
+        uint64_t start_time = lv_benchmark_scenes_get_time();
+        lv_demo_widgets();
+        uint64_t created_time = lv_benchmark_scenes_get_time();
+        lv_refr_now(NULL);
+        uint64_t rendered_time = lv_benchmark_scenes_get_time();
+        lv_demo_widgets_close();
+        uint64_t deleted_time = lv_benchmark_scenes_get_time();
+
+        create_time += created_time - start_time;
+        render_time += rendered_time - created_time;
+        delete_time += deleted_time - rendered_time;
+    }
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+    const char* backend = "BUILTIN";
+#elif LV_USE_STDLIB_MALLOC == LV_STDLIB_CLIB
+    const char* backend = "CLIB";
+#elif LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+    const char* backend = "CUSTOM";
+#else
+    const char* backend = "OTHER";
+#endif
+
+    std::printf(
+        "Widgets allocation benchmark: %u rounds, LV_USE_STDLIB_MALLOC %s\n",
+        round_count,
+        backend);
+    std::printf("phase,avg_us\n");
+    std::printf("create,%.1f\n", create_time / 1e3 / round_count);
+    std::printf("render,%.1f\n", render_time / 1e3 / round_count);
+    std::printf("delete,%.1f\n", delete_time / 1e3 / round_count);
+
+    // The C runtime backend doesn't report the memory usage.
+    lv_mem_monitor_t monitor;
+    lv_mem_monitor(&monitor);
+    if (monitor.max_used)
+    {
+        std::printf(
+            "Peak memory usage: %zu bytes\n",
+            static_cast<size_t>(monitor.max_used));
+    }
+
+    return true;
+#else
+    LV_UNUSED(round_count);
+    return false;
+#endif
+}
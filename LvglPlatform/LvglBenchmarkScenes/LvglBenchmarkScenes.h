@@ -0,0 +1,70 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglBenchmarkScenes.h
+ * PURPOSE:   Definition for the platform specific LVGL benchmark scenes
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#ifndef LVGL_BENCHMARK_SCENES_H
+#define LVGL_BENCHMARK_SCENES_H
+
+#include "lvgl/lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Creates the image cache benchmark scene on the active screen, which
+ *        moves a grid of indexed color images back and forth. LVGL decodes
+ *        the indexed color images to ARGB8888 before drawing them, so the
+ *        images are decoded again for every frame if the image cache is
+ *        disabled or too small to hold them.
+ * @param duration The duration of the scene in milliseconds.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark When the scene is finished, the active screen is cleaned and a
+ *         summary label is created on it, which is the same as what
+ *         lv_demo_benchmark does, so the scene can be measured by
+ *         lv_benchmark_runner.
+ */
+bool lv_benchmark_scenes_image_cache(
+    uint32_t duration);
+
+/**
+ * @brief Measures the throughput of the style property lookups over a widget
+ *        tree on the active screen, with lv_obj_get_style_prop and with the
+ *        resolved property cache of LvglStyleCache, and prints the results to
+ *        the standard output.
+ * @param object_count The number of objects in the widget tree.
+ * @param round_count The number of rounds, and every round looks up the hot
+ *                    style properties of all objects once.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark The widget tree is deleted when the measurement is finished. Both
+ *         lookups are also measured with 1% of the objects changing their
+ *         state in every round, which shows the cost of the invalidation.
+ */
+bool lv_benchmark_scenes_style_lookup(
+    uint32_t object_count,
+    uint32_t round_count);
+
+/**
+ * @brief Measures the allocation heavy phases of lv_demo_widgets, which are
+ *        creating the widgets, rendering the first frame and deleting the
+ *        widgets, and prints the average time of every phase and the peak
+ *        memory usage reported by lv_mem_monitor to the standard output.
+ * @param round_count The number of rounds.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark The results are used for comparing the LV_USE_STDLIB_MALLOC
+ *         backends, so this function requires LV_USE_DEMO_WIDGETS.
+ */
+bool lv_benchmark_scenes_widgets_allocation(
+    uint32_t round_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !LVGL_BENCHMARK_SCENES_H */
@@ -0,0 +1,438 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglCircleCache.cpp
+ * PURPOSE:   Implementation for the radius keyed rounded corner mask cache
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglCircleCache.h"
+
+#include "lvgl/src/lvgl_private.h"
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// The number of lookups after which the use frequencies of all entries are
+// halved, so the frequencies reflect the recent screens instead of the whole
+// run time.
+static const uint64_t g_circle_cache_aging_period = 4096;
+
+typedef struct _lv_circle_cache_entry_t
+{
+    int32_t radius;
+    size_t size;
+    uint32_t frequency = 0;
+    uint64_t last_use = 0;
+    std::once_flag rendered;
+    bool valid = false;
+    // The mask of a (2 * radius) x (2 * radius) rounded rectangle, whose
+    // quadrants are the four corners.
+    std::vector<lv_opa_t> mask;
+} lv_circle_cache_entry_t;
+
+typedef std::shared_ptr<lv_circle_cache_entry_t> lv_circle_cache_entry_ptr_t;
+
+static struct
+{
+    std::mutex mutex;
+    size_t budget = LV_CIRCLE_CACHE_SIZE;
+    size_t used_size = 0;
+    uint64_t use_count = 0;
+    std::unordered_map<int32_t, lv_circle_cache_entry_ptr_t> entries;
+    uint64_t hit_count = 0;
+    uint64_t miss_count = 0;
+    uint64_t eviction_count = 0;
+    uint64_t bypass_count = 0;
+} g_circle_cache;
+
+static void lv_circle_cache_evict(
+    size_t budget)
+{
+    while (!g_circle_cache.entries.empty()
+        && g_circle_cache.used_size > budget)
+    {
+        auto victim = g_circle_cache.entries.begin();
+        for (auto iterator = g_circle_cache.entries.begin();
+            iterator != g_circle_cache.entries.end();
+            ++iterator)
+        {
+            const lv_circle_cache_entry_ptr_t& current = iterator->second;
+            const lv_circle_cache_entry_ptr_t& candidate = victim->second;
+            if (current->frequency < candidate->frequency
+                || (current->frequency == candidate->frequency
+                    && current->last_use < candidate->last_use))
+            {
+                victim = iterator;
+            }
+        }
+
+        g_circle_cache.used_size -= victim->second->size;
+        g_circle_cache.entries.erase(victim);
+        ++g_circle_cache.eviction_count;
+    }
+}
+
+static void lv_circle_cache_remove(
+    const lv_circle_cache_entry_ptr_t& entry)
+{
+    std::lock_guard<std::mutex> lock(g_circle_cache.mutex);
+
+    auto iterator = g_circle_cache.entries.find(entry->radius);
+    if (iterator != g_circle_cache.entries.end()
+        && iterator->second == entry)
+    {
+        g_circle_cache.used_size -= entry->size;
+        g_circle_cache.entries.erase(iterator);
+    }
+}
+
+static lv_circle_cache_entry_ptr_t lv_circle_cache_acquire(
+    int32_t radius)
+{
+    size_t size = static_cast<size_t>(radius) * radius * 4;
+
+    std::lock_guard<std::mutex> lock(g_circle_cache.mutex);
+
+    if (0 == ++g_circle_cache.use_count % g_circle_cache_aging_period)
+    {
+        for (auto& entry : g_circle_cache.entries)
+        {
+            entry.second->frequency /= 2;
+        }
+    }
+
+    auto iterator = g_circle_cache.entries.find(radius);
+    if (iterator != g_circle_cache.entries.end())
+    {
+        ++g_circle_cache.hit_count;
+        ++iterator->second->frequency;
+        iterator->second->last_use = g_circle_cache.use_count;
+        return iterator->second;
+    }
+
+    if (size > g_circle_cache.budget / 4)
+    {
+        ++g_circle_cache.bypass_count;
+        return nullptr;
+    }
+
+    ++g_circle_cache.miss_count;
+    lv_circle_cache_evict(g_circle_cache.budget - size);
+
+    lv_circle_cache_entry_ptr_t entry =
+        std::make_shared<lv_circle_cache_entry_t>();
+    entry->radius = radius;
+    entry->size = size;
+    entry->frequency = 1;
+    entry->last_use = g_circle_cache.use_count;
+    g_circle_cache.entries.emplace(radius, entry);
+    g_circle_cache.used_size += size;
+
+    return entry;
+}
+
+static bool lv_circle_cache_render(
+    lv_draw_task_t* t,
+    int32_t radius,
+    std::vector<lv_opa_t>& mask)
+{
+    int32_t size = radius * 2;
+
+    lv_draw_buf_t* draw_buf = lv_draw_buf_create(
+        static_cast<uint32_t>(size),
+        static_cast<uint32_t>(size),
+        LV_COLOR_FORMAT_ARGB8888,
+        LV_STRIDE_AUTO);
+    if (!draw_buf)
+    {
+        return false;
+    }
+    lv_draw_buf_clear(draw_buf, NULL);
+
+    lv_area_t area;
+    area.x1 = 0;
+    area.y1 = 0;
+    area.x2 = size - 1;
+    area.y2 = size - 1;
+
+    // Render the rounded rectangle in opaque white into a transparent layer,
+    // so the alpha channel of the layer is the corner mask of LVGL.
+    lv_layer_t layer;
+    lv_layer_init(&layer);
+    layer.draw_buf = draw_buf;
+    layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+    layer.buf_area = area;
+    layer._clip_area = area;
+    layer.phy_clip_area = area;
+
+    lv_draw_task_t mask_task = *t;
+    mask_task.target_layer = &layer;
+    mask_task.clip_area = area;
+
+    lv_draw_fill_dsc_t mask_dsc;
+    lv_draw_fill_dsc_init(&mask_dsc);
+    mask_dsc.color = lv_color_white();
+    mask_dsc.opa = LV_OPA_COVER;
+    mask_dsc.radius = radius;
+
+    lv_draw_sw_fill(&mask_task, &mask_dsc, &area);
+
+    mask.resize(static_cast<size_t>(size) * size);
+    for (int32_t y = 0; y < size; ++y)
+    {
+        const uint8_t* source =
+            draw_buf->data + static_cast<size_t>(draw_buf->header.stride) * y;
+        lv_opa_t* destination = &mask[static_cast<size_t>(size) * y];
+        for (int32_t x = 0; x < size; ++x)
+        {
+            destination[x] = source[x * 4 + 3];
+        }
+    }
+
+    lv_draw_buf_destroy(draw_buf);
+
+    return true;
+}
+
+static void lv_circle_cache_blend(
+    lv_draw_task_t* t,
+    lv_color_t color,
+    lv_opa_t opa,
+    const lv_area_t* blend_area,
+    const lv_opa_t* mask_buf,
+    const lv_area_t* mask_area,
+    int32_t mask_stride)
+{
+    if (blend_area->x1 > blend_area->x2 || blend_area->y1 > blend_area->y2)
+    {
+        return;
+    }
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    std::memset(&blend_dsc, 0, sizeof(blend_dsc));
+    blend_dsc.blend_area = blend_area;
+    blend_dsc.mask_buf = mask_buf;
+    blend_dsc.mask_area = mask_area;
+    blend_dsc.mask_stride = mask_stride;
+    blend_dsc.mask_res = mask_buf
+        ? LV_DRAW_SW_MASK_RES_CHANGED
+        : LV_DRAW_SW_MASK_RES_FULL_COVER;
+    blend_dsc.color = color;
+    blend_dsc.opa = opa;
+    blend_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    lv_draw_sw_blend(t, &blend_dsc);
+}
+
+bool lv_circle_cache_draw_fill(
+    lv_draw_task_t* t,
+    const lv_draw_fill_dsc_t* dsc,
+    const lv_area_t* coords)
+{
+    if (!t || !dsc || !coords)
+    {
+        return false;
+    }
+
+    if (LV_GRAD_DIR_NONE != dsc->grad.dir)
+    {
+        return false;
+    }
+
+    // The same radius as the one calculated by lv_draw_sw_fill.
+    int32_t width = lv_area_get_width(coords);
+    int32_t height = lv_area_get_height(coords);
+    int32_t radius = LV_MIN(dsc->radius, LV_MIN(width, height) >> 1);
+    if (radius <= 0)
+    {
+        return false;
+    }
+
+    if (dsc->opa <= LV_OPA_MIN)
+    {
+        return true;
+    }
+
+    lv_area_t draw_area;
+    if (!lv_area_intersect(&draw_area, coords, &t->clip_area))
+    {
+        return true;
+    }
+
+    lv_circle_cache_entry_ptr_t entry = lv_circle_cache_acquire(radius);
+    if (!entry)
+    {
+        return false;
+    }
+
+    // The workers drawing the other tiles with the same radius wait here until
+    // the mask is rendered, instead of rendering it again.
+    std::call_once(entry->rendered, [&]()
+    {
+        entry->valid = lv_circle_cache_render(t, radius, entry->mask);
+    });
+    if (!entry->valid)
+    {
+        lv_circle_cache_remove(entry);
+        return false;
+    }
+
+    lv_opa_t opa = dsc->opa > LV_OPA_MAX ? LV_OPA_COVER : dsc->opa;
+    int32_t mask_size = radius * 2;
+    const lv_opa_t* mask = entry->mask.data();
+
+    int32_t x1 = coords->x1;
+    int32_t y1 = coords->y1;
+    int32_t x2 = coords->x2;
+    int32_t y2 = coords->y2;
+    int32_t r = radius - 1;
+    int32_t m = mask_size - 1;
+
+    // Every corner is blended with the quadrant of the mask which is aligned
+    // to the same corner of the rectangle.
+    const lv_area_t corners[4] =
+    {
+        { x1, y1, x1 + r, y1 + r },
+        { x2 - r, y1, x2, y1 + r },
+        { x1, y2 - r, x1 + r, y2 },
+        { x2 - r, y2 - r, x2, y2 },
+    };
+    const lv_area_t mask_areas[4] =
+    {
+        { x1, y1, x1 + m, y1 + m },
+        { x2 - m, y1, x2, y1 + m },
+        { x1, y2 - m, x1 + m, y2 },
+        { x2 - m, y2 - m, x2, y2 },
+    };
+    for (size_t i = 0; i < 4; ++i)
+    {
+        lv_circle_cache_blend(
+            t,
+            dsc->color,
+            opa,
+            &corners[i],
+            mask,
+            &mask_areas[i],
+            mask_size);
+    }
+
+    // The parts of the corner rows between the corners. LVGL blends the whole
+    // corner rows with the mask, which is fully opaque here, and the fully
+    // opaque mask is not the same as no mask when the opacity is not opaque.
+    const lv_area_t strips[2] =
+    {
+        { x1 + radius, y1, x2 - radius, y1 + r },
+        { x1 + radius, y2 - r, x2 - radius, y2 },
+    };
+    if (opa >= LV_OPA_MAX)
+    {
+        for (size_t i = 0; i < 2; ++i)
+        {
+            lv_circle_cache_blend(
+                t,
+                dsc->color,
+                opa,
+                &strips[i],
+                NULL,
+                NULL,
+                0);
+        }
+    }
+    else if (strips[0].x1 <= strips[0].x2)
+    {
+        std::vector<lv_opa_t> cover(
+            static_cast<size_t>(lv_area_get_width(&strips[0])),
+            LV_OPA_COVER);
+        for (size_t i = 0; i < 2; ++i)
+        {
+            for (int32_t y = strips[i].y1; y <= strips[i].y2; ++y)
+            {
+                lv_area_t row = strips[i];
+                row.y1 = y;
+                row.y2 = y;
+                lv_circle_cache_blend(
+                    t,
+                    dsc->color,
+                    opa,
+                    &row,
+                    cover.data(),
+                    &row,
+                    lv_area_get_width(&row));
+            }
+        }
+    }
+
+    lv_area_t center = *coords;
+    center.y1 += radius;
+    center.y2 -= radius;
+    lv_circle_cache_blend(t, dsc->color, opa, &center, NULL, NULL, 0);
+
+    return true;
+}
+
+void lv_circle_cache_set_budget(
+    size_t budget)
+{
+    std::lock_guard<std::mutex> lock(g_circle_cache.mutex);
+
+    g_circle_cache.budget = budget;
+    lv_circle_cache_evict(budget);
+}
+
+bool lv_circle_cache_get_stats(
+    lv_circle_cache_stats_t* stats)
+{
+    if (!stats)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(g_circle_cache.mutex);
+
+    stats->budget = g_circle_cache.budget;
+    stats->used_size = g_circle_cache.used_size;
+    stats->entry_count = static_cast<uint32_t>(g_circle_cache.entries.size());
+    stats->hit_count = g_circle_cache.hit_count;
+    stats->miss_count = g_circle_cache.miss_count;
+    stats->eviction_count = g_circle_cache.eviction_count;
+    stats->bypass_count = g_circle_cache.bypass_count;
+
+    return true;
+}
+
+void lv_circle_cache_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_circle_cache_stats_t stats;
+    if (!buffer || !buffer_size || !lv_circle_cache_get_stats(&stats))
+    {
+        return;
+    }
+
+    uint64_t lookup_count = stats.hit_count + stats.miss_count;
+    std::snprintf(
+        buffer,
+        buffer_size,
+        "%u radii, %zu/%zu KiB, %llu hits (%u%%), %llu misses, "
+        "%llu evictions, %llu bypassed",
+        stats.entry_count,
+        stats.used_size / 1024,
+        stats.budget / 1024,
+        static_cast<unsigned long long>(stats.hit_count),
+        lookup_count
+            ? static_cast<uint32_t>(stats.hit_count * 100 / lookup_count)
+            : 0,
+        static_cast<unsigned long long>(stats.miss_count),
+        static_cast<unsigned long long>(stats.eviction_count),
+        static_cast<unsigned long long>(stats.bypass_count));
+}
@@ -0,0 +1,103 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglCircleCache.h
+ * PURPOSE:   Definition for the radius keyed rounded corner mask cache
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#ifndef LVGL_CIRCLE_CACHE_H
+#define LVGL_CIRCLE_CACHE_H
+
+#include "lvgl/lvgl.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The default budget in bytes of the rounded corner mask cache. Every
+ *        cached radius costs (2 * radius)^2 bytes, so the default is enough
+ *        for dozens of the radii used by the default theme and the demos.
+ */
+#ifndef LV_CIRCLE_CACHE_SIZE
+#define LV_CIRCLE_CACHE_SIZE (256 * 1024)
+#endif
+
+typedef struct _lv_circle_cache_stats_t
+{
+    size_t budget;
+    size_t used_size;
+    uint32_t entry_count;
+    uint64_t hit_count;
+    uint64_t miss_count;
+    uint64_t eviction_count;
+    // The rounded fills drawn without the cache because the mask of the radius
+    // is larger than the quarter of the budget.
+    uint64_t bypass_count;
+} lv_circle_cache_stats_t;
+
+/**
+ * @brief Draws a rounded rectangle fill with the rounded corner mask cache,
+ *        which keeps the anti-aliased corner masks keyed by the radius. The
+ *        corners are blended with the cached masks and the rest of the
+ *        rectangle is blended without masks, so the quarter circles are not
+ *        calculated again for every row of every frame.
+ * @param t The draw task of the fill.
+ * @param dsc The draw descriptor of the fill.
+ * @param coords The coordinates of the rectangle.
+ * @return If the rectangle is drawn, return true. Otherwise, return false, and
+ *         the caller should draw the rectangle with lv_draw_sw_fill. The fills
+ *         without radius or with gradient are not supported.
+ * @remark This function is thread-safe, so it can be called by the workers of
+ *         the parallel draw unit. When the budget is exceeded, the entry with
+ *         the lowest use frequency is evicted, and the least recently used one
+ *         among them. The frequencies are halved periodically, so the radii
+ *         which are no longer used, e.g. the ones of the previous screen, are
+ *         retained only until the new radii become more frequent.
+ */
+bool lv_circle_cache_draw_fill(
+    lv_draw_task_t* t,
+    const lv_draw_fill_dsc_t* dsc,
+    const lv_area_t* coords);
+
+/**
+ * @brief Sets the budget of the rounded corner mask cache.
+ * @param budget The budget in bytes. 0 means the cache is disabled.
+ * @remark The default is LV_CIRCLE_CACHE_SIZE, which can be overridden by the
+ *         preprocessor definitions of the project. The entries exceeding the
+ *         new budget are evicted immediately.
+ */
+void lv_circle_cache_set_budget(
+    size_t budget);
+
+/**
+ * @brief Gets the statistics of the rounded corner mask cache.
+ * @param stats The statistics of the rounded corner mask cache.
+ * @return If succeed, return true. Otherwise, return false.
+ */
+bool lv_circle_cache_get_stats(
+    lv_circle_cache_stats_t* stats);
+
+/**
+ * @brief Formats the statistics of the rounded corner mask cache as a single
+ *        line of text, which can be used as the callback of
+ *        lv_stats_monitor_add_source.
+ * @param buffer The buffer which receives the formatted statistics.
+ * @param buffer_size The size of the buffer in bytes.
+ * @param user_data Unused.
+ */
+void lv_circle_cache_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !LVGL_CIRCLE_CACHE_H */
@@ -0,0 +1,505 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglDirtyAreaCoalescer.cpp
+ * PURPOSE:   Implementation for the cost based coalescing of the invalidated
+ *            areas of LVGL displays
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglDirtyAreaCoalescer.h"
+
+#include "lvgl/src/lvgl_private.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+typedef enum _lv_dirty_area_coalescer_action_t
+{
+    LV_DIRTY_AREA_COALESCER_ACTION_NONE,
+    LV_DIRTY_AREA_COALESCER_ACTION_MERGE,
+    LV_DIRTY_AREA_COALESCER_ACTION_SPLIT,
+} lv_dirty_area_coalescer_action_t;
+
+typedef struct _lv_dirty_area_coalescer_context_t
+{
+    lv_display_t* display;
+    int64_t area_overhead;
+    // The areas invalidated since the previous render, before merging.
+    std::vector<lv_area_t> invalidated_areas;
+    // Reused by the counting of the invalidated pixels.
+    std::vector<int32_t> edges;
+    std::vector<std::pair<int32_t, int32_t>> spans;
+    lv_dirty_area_coalescer_stats_t stats;
+} lv_dirty_area_coalescer_context_t;
+
+// Only accessed from the LVGL thread.
+static std::vector<lv_dirty_area_coalescer_context_t*>
+    g_dirty_area_coalescer_contexts;
+
+static lv_dirty_area_coalescer_context_t* lv_dirty_area_coalescer_find_context(
+    lv_display_t* display)
+{
+    for (lv_dirty_area_coalescer_context_t* context
+        : g_dirty_area_coalescer_contexts)
+    {
+        if (display == context->display)
+        {
+            return context;
+        }
+    }
+
+    return NULL;
+}
+
+static int64_t lv_dirty_area_coalescer_get_size(
+    const lv_area_t* area)
+{
+    return static_cast<int64_t>(lv_area_get_width(area))
+        * lv_area_get_height(area);
+}
+
+// Splits the area into the parts outside the hole, which are the full width
+// bands above and below the hole, and the parts on its left and right.
+static uint32_t lv_dirty_area_coalescer_split(
+    const lv_area_t* area,
+    const lv_area_t* hole,
+    lv_area_t parts[4])
+{
+    uint32_t count = 0;
+    int32_t y1 = area->y1;
+    int32_t y2 = area->y2;
+    if (hole->y1 > area->y1)
+    {
+        lv_area_set(
+            &parts[count++],
+            area->x1,
+            area->y1,
+            area->x2,
+            hole->y1 - 1);
+        y1 = hole->y1;
+    }
+    if (hole->y2 < area->y2)
+    {
+        lv_area_set(
+            &parts[count++],
+            area->x1,
+            hole->y2 + 1,
+            area->x2,
+            area->y2);
+        y2 = hole->y2;
+    }
+    if (hole->x1 > area->x1)
+    {
+        lv_area_set(&parts[count++], area->x1, y1, hole->x1 - 1, y2);
+    }
+    if (hole->x2 < area->x2)
+    {
+        lv_area_set(&parts[count++], hole->x2 + 1, y1, area->x2, y2);
+    }
+    return count;
+}
+
+// Checks whether the area is inside one of the invalidated areas, which LVGL
+// drops instead of saving it.
+static bool lv_dirty_area_coalescer_is_covered(
+    lv_display_t* display,
+    const lv_area_t* area)
+{
+    for (uint32_t i = 0; i < display->inv_p; ++i)
+    {
+        if (lv_area_is_in(area, &display->inv_areas[i], 0))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Merges the other invalidated areas into the specified one as long as
+// rendering their bounding box is cheaper than rendering both, and returns
+// the new index of the area.
+static uint32_t lv_dirty_area_coalescer_merge_neighbors(
+    lv_dirty_area_coalescer_context_t* context,
+    uint32_t index)
+{
+    lv_display_t* display = context->display;
+
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+        for (uint32_t i = 0; i < display->inv_p; ++i)
+        {
+            if (i == index)
+            {
+                continue;
+            }
+
+            lv_area_t joined_area;
+            lv_area_join(
+                &joined_area,
+                &display->inv_areas[index],
+                &display->inv_areas[i]);
+            int64_t separate_cost =
+                lv_dirty_area_coalescer_get_size(&display->inv_areas[index])
+                + lv_dirty_area_coalescer_get_size(&display->inv_areas[i])
+                + 2 * context->area_overhead;
+            int64_t merged_cost =
+                lv_dirty_area_coalescer_get_size(&joined_area)
+                + context->area_overhead;
+            if (merged_cost >= separate_cost)
+            {
+                continue;
+            }
+
+            display->inv_areas[index] = joined_area;
+            display->inv_areas[i] = display->inv_areas[display->inv_p - 1];
+            --display->inv_p;
+            if (index == display->inv_p)
+            {
+                index = i;
+            }
+            ++context->stats.merged_count;
+            merged = true;
+            break;
+        }
+    }
+
+    return index;
+}
+
+static void lv_dirty_area_coalescer_invalidate(
+    lv_dirty_area_coalescer_context_t* context,
+    lv_area_t* area)
+{
+    lv_display_t* display = context->display;
+
+    ++context->stats.invalidated_area_count;
+    if (context->invalidated_areas.size()
+        < LV_DIRTY_AREA_COALESCER_MAX_TRACKED_AREAS)
+    {
+        context->invalidated_areas.push_back(*area);
+    }
+    else
+    {
+        lv_area_join(
+            &context->invalidated_areas.back(),
+            &context->invalidated_areas.back(),
+            area);
+    }
+
+    if (lv_dirty_area_coalescer_is_covered(display, area))
+    {
+        return;
+    }
+
+    // Compare every action with keeping the area separately, which renders
+    // the overlap with an existing area twice and pays the overhead twice.
+    int64_t area_size = lv_dirty_area_coalescer_get_size(area);
+    lv_dirty_area_coalescer_action_t action =
+        LV_DIRTY_AREA_COALESCER_ACTION_NONE;
+    int64_t best_benefit = 0;
+    uint32_t best_index = 0;
+    lv_area_t best_parts[4];
+    uint32_t best_part_count = 0;
+    // Used when the buffer is full, which would redraw the whole screen.
+    int64_t cheapest_merge_growth = INT64_MAX;
+    uint32_t cheapest_merge_index = 0;
+    for (uint32_t i = 0; i < display->inv_p; ++i)
+    {
+        const lv_area_t* existing_area = &display->inv_areas[i];
+        int64_t existing_size =
+            lv_dirty_area_coalescer_get_size(existing_area);
+
+        lv_area_t joined_area;
+        lv_area_join(&joined_area, existing_area, area);
+        int64_t joined_size = lv_dirty_area_coalescer_get_size(&joined_area);
+        int64_t merge_benefit = existing_size + area_size
+            + context->area_overhead
+            - joined_size;
+        if (merge_benefit > best_benefit)
+        {
+            action = LV_DIRTY_AREA_COALESCER_ACTION_MERGE;
+            best_benefit = merge_benefit;
+            best_index = i;
+        }
+        if (joined_size - existing_size < cheapest_merge_growth)
+        {
+            cheapest_merge_growth = joined_size - existing_size;
+            cheapest_merge_index = i;
+        }
+
+        lv_area_t overlap_area;
+        if (!lv_area_intersect(&overlap_area, existing_area, area))
+        {
+            continue;
+        }
+
+        // Splitting saves the overlap, but every extra part pays the
+        // overhead.
+        lv_area_t parts[4];
+        uint32_t part_count =
+            lv_dirty_area_coalescer_split(area, existing_area, parts);
+        int64_t split_benefit =
+            lv_dirty_area_coalescer_get_size(&overlap_area)
+            - (static_cast<int64_t>(part_count) - 1) * context->area_overhead;
+        if (split_benefit > best_benefit
+            && display->inv_p + part_count <= LV_INV_BUF_SIZE)
+        {
+            action = LV_DIRTY_AREA_COALESCER_ACTION_SPLIT;
+            best_benefit = split_benefit;
+            best_index = i;
+            std::copy(parts, parts + part_count, best_parts);
+            best_part_count = part_count;
+        }
+    }
+
+    if (LV_DIRTY_AREA_COALESCER_ACTION_NONE == action
+        && display->inv_p >= LV_INV_BUF_SIZE)
+    {
+        action = LV_DIRTY_AREA_COALESCER_ACTION_MERGE;
+        best_index = cheapest_merge_index;
+        ++context->stats.forced_merge_count;
+    }
+
+    switch (action)
+    {
+    case LV_DIRTY_AREA_COALESCER_ACTION_MERGE:
+        lv_area_join(
+            &display->inv_areas[best_index],
+            &display->inv_areas[best_index],
+            area);
+        ++context->stats.merged_count;
+        best_index = lv_dirty_area_coalescer_merge_neighbors(
+            context,
+            best_index);
+        break;
+    case LV_DIRTY_AREA_COALESCER_ACTION_SPLIT:
+        // Every part is saved like a new invalidated area, so the parts inside
+        // the other areas are dropped, and the parts are merged with their
+        // neighbors when it is cheaper.
+        for (uint32_t i = 0; i < best_part_count; ++i)
+        {
+            if (lv_dirty_area_coalescer_is_covered(display, &best_parts[i]))
+            {
+                continue;
+            }
+
+            display->inv_areas[display->inv_p++] = best_parts[i];
+            best_index = lv_dirty_area_coalescer_merge_neighbors(
+                context,
+                display->inv_p - 1);
+        }
+        ++context->stats.split_count;
+        break;
+    default:
+        return;
+    }
+
+    // The area is covered by the invalidated areas now, so make LVGL drop it
+    // instead of saving it again.
+    *area = display->inv_areas[best_index];
+}
+
+static uint64_t lv_dirty_area_coalescer_get_union_size(
+    lv_dirty_area_coalescer_context_t* context)
+{
+    // Sweep the vertical slabs between the distinct horizontal edges, and
+    // merge the vertical spans of the areas covering every slab.
+    std::vector<int32_t>& edges = context->edges;
+    edges.clear();
+    for (const lv_area_t& area : context->invalidated_areas)
+    {
+        edges.push_back(area.x1);
+        edges.push_back(area.x2 + 1);
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    std::vector<std::pair<int32_t, int32_t>>& spans = context->spans;
+    uint64_t size = 0;
+    for (size_t i = 0; i + 1 < edges.size(); ++i)
+    {
+        spans.clear();
+        for (const lv_area_t& area : context->invalidated_areas)
+        {
+            if (area.x1 <= edges[i] && area.x2 + 1 >= edges[i + 1])
+            {
+                spans.emplace_back(area.y1, area.y2 + 1);
+            }
+        }
+        std::sort(spans.begin(), spans.end());
+
+        uint64_t height = 0;
+        int32_t covered = INT32_MIN;
+        for (const std::pair<int32_t, int32_t>& span : spans)
+        {
+            int32_t start = LV_MAX(span.first, covered);
+            if (span.second > start)
+            {
+                height += span.second - start;
+                covered = span.second;
+            }
+        }
+        size += height * (edges[i + 1] - edges[i]);
+    }
+
+    return size;
+}
+
+static void lv_dirty_area_coalescer_render_start(
+    lv_dirty_area_coalescer_context_t* context)
+{
+    lv_display_t* display = context->display;
+
+    // The areas are joined by LVGL before the render starts.
+    uint64_t rendered_area_count = 0;
+    uint64_t rendered_pixel_count = 0;
+    for (uint32_t i = 0; i < display->inv_p; ++i)
+    {
+        if (!display->inv_area_joined[i])
+        {
+            ++rendered_area_count;
+            rendered_pixel_count += lv_area_get_size(&display->inv_areas[i]);
+        }
+    }
+
+    uint64_t invalidated_pixel_count =
+        lv_dirty_area_coalescer_get_union_size(context);
+    context->invalidated_areas.clear();
+
+    ++context->stats.frame_count;
+    context->stats.rendered_area_count += rendered_area_count;
+    context->stats.rendered_pixel_count += rendered_pixel_count;
+    context->stats.invalidated_pixel_count += invalidated_pixel_count;
+    if (rendered_pixel_count > invalidated_pixel_count)
+    {
+        context->stats.overdrawn_pixel_count +=
+            rendered_pixel_count - invalidated_pixel_count;
+    }
+}
+
+static void lv_dirty_area_coalescer_display_event_callback(
+    lv_event_t* e)
+{
+    lv_dirty_area_coalescer_context_t* context =
+        static_cast<lv_dirty_area_coalescer_context_t*>(
+            lv_event_get_user_data(e));
+
+    switch (lv_event_get_code(e))
+    {
+    case LV_EVENT_INVALIDATE_AREA:
+        lv_dirty_area_coalescer_invalidate(
+            context,
+            static_cast<lv_area_t*>(lv_event_get_param(e)));
+        break;
+    case LV_EVENT_RENDER_START:
+        lv_dirty_area_coalescer_render_start(context);
+        break;
+    case LV_EVENT_DELETE:
+        for (size_t i = 0; i < g_dirty_area_coalescer_contexts.size(); ++i)
+        {
+            if (context == g_dirty_area_coalescer_contexts[i])
+            {
+                g_dirty_area_coalescer_contexts.erase(
+                    g_dirty_area_coalescer_contexts.begin() + i);
+                break;
+            }
+        }
+        delete context;
+        break;
+    default:
+        break;
+    }
+}
+
+bool lv_dirty_area_coalescer_attach_display(
+    lv_display_t* display,
+    uint32_t area_overhead)
+{
+    if (!display || lv_dirty_area_coalescer_find_context(display))
+    {
+        return false;
+    }
+
+    lv_dirty_area_coalescer_context_t* context =
+        new lv_dirty_area_coalescer_context_t();
+    context->display = display;
+    context->area_overhead = area_overhead;
+    g_dirty_area_coalescer_contexts.push_back(context);
+
+    static const lv_event_code_t event_codes[] =
+    {
+        LV_EVENT_INVALIDATE_AREA,
+        LV_EVENT_RENDER_START,
+        LV_EVENT_DELETE
+    };
+    for (lv_event_code_t event_code : event_codes)
+    {
+        lv_display_add_event_cb(
+            display,
+            lv_dirty_area_coalescer_display_event_callback,
+            event_code,
+            context);
+    }
+
+    return true;
+}
+
+bool lv_dirty_area_coalescer_get_stats(
+    lv_display_t* display,
+    lv_dirty_area_coalescer_stats_t* stats)
+{
+    if (!stats)
+    {
+        return false;
+    }
+
+    lv_dirty_area_coalescer_context_t* context =
+        lv_dirty_area_coalescer_find_context(display);
+    if (!context)
+    {
+        return false;
+    }
+
+    *stats = context->stats;
+
+    return true;
+}
+
+void lv_dirty_area_coalescer_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data)
+{
+    lv_dirty_area_coalescer_stats_t stats;
+    if (!buffer
+        || !buffer_size
+        || !lv_dirty_area_coalescer_get_stats(
+            static_cast<lv_display_t*>(user_data),
+            &stats))
+    {
+        return;
+    }
+
+    std::snprintf(
+        buffer,
+        buffer_size,
+        "%llu -> %llu areas, %llu merged, %llu split, %llu forced, "
+        "%llu%% overdrawn",
+        static_cast<unsigned long long>(stats.invalidated_area_count),
+        static_cast<unsigned long long>(stats.rendered_area_count),
+        static_cast<unsigned long long>(stats.merged_count),
+        static_cast<unsigned long long>(stats.split_count),
+        static_cast<unsigned long long>(stats.forced_merge_count),
+        static_cast<unsigned long long>(
+            stats.rendered_pixel_count
+            ? stats.overdrawn_pixel_count * 100 / stats.rendered_pixel_count
+            : 0));
+}
@@ -0,0 +1,107 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglDirtyAreaCoalescer.h
+ * PURPOSE:   Definition for the cost based coalescing of the invalidated
+ *            areas of LVGL displays
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#ifndef LVGL_DIRTY_AREA_COALESCER_H
+#define LVGL_DIRTY_AREA_COALESCER_H
+
+#include "lvgl/lvgl.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The default fixed cost of rendering an area in pixels, which covers
+ *        walking the object tree, setting up the layer and flushing.
+ */
+#ifndef LV_DIRTY_AREA_COALESCER_AREA_OVERHEAD
+#define LV_DIRTY_AREA_COALESCER_AREA_OVERHEAD 4096
+#endif
+
+/**
+ * @brief The maximum number of invalidated areas of a frame kept for counting
+ *        the overdrawn pixels. The areas beyond it are joined into the last
+ *        one, so the overdrawn pixels are underestimated.
+ */
+#ifndef LV_DIRTY_AREA_COALESCER_MAX_TRACKED_AREAS
+#define LV_DIRTY_AREA_COALESCER_MAX_TRACKED_AREAS 256
+#endif
+
+typedef struct _lv_dirty_area_coalescer_stats_t
+{
+    // The number of rendered frames.
+    uint64_t frame_count;
+    // The number of areas invalidated on the display, before merging.
+    uint64_t invalidated_area_count;
+    // The number of areas rendered, after merging.
+    uint64_t rendered_area_count;
+    // The number of times two areas were merged into their bounding box.
+    uint64_t merged_count;
+    // The number of times a new area was split around an existing one.
+    uint64_t split_count;
+    // The number of merges made because the invalidated area buffer of the
+    // display was full, which would redraw the whole screen otherwise.
+    uint64_t forced_merge_count;
+    // The number of pixels covered by the invalidated areas.
+    uint64_t invalidated_pixel_count;
+    // The number of pixels rendered, including the overlaps rendered twice.
+    uint64_t rendered_pixel_count;
+    // The number of pixels rendered but not invalidated, or rendered more
+    // than once.
+    uint64_t overdrawn_pixel_count;
+} lv_dirty_area_coalescer_stats_t;
+
+/**
+ * @brief Coalesces the areas invalidated on the display by a cost model,
+ *        where rendering an area costs its pixel count plus a fixed overhead.
+ *        A new area is merged with an existing area into their bounding box,
+ *        or split around it, or kept separately, whichever is the cheapest.
+ * @param display The display.
+ * @param area_overhead The fixed cost of rendering an area in pixels. 0 means
+ *                      only the pixel count is considered.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark The join of the overlapping areas by LVGL before rendering still
+ *         happens afterwards.
+ */
+bool lv_dirty_area_coalescer_attach_display(
+    lv_display_t* display,
+    uint32_t area_overhead);
+
+/**
+ * @brief Gets the statistics of the coalescing of the display.
+ * @param display The display.
+ * @param stats The statistics.
+ * @return If succeed, return true. Otherwise, return false.
+ */
+bool lv_dirty_area_coalescer_get_stats(
+    lv_display_t* display,
+    lv_dirty_area_coalescer_stats_t* stats);
+
+/**
+ * @brief Formats the statistics of the coalescing of a display as a single
+ *        line of text, which can be used as the callback of
+ *        lv_stats_monitor_add_source.
+ * @param buffer The buffer which receives the formatted statistics.
+ * @param buffer_size The size of the buffer in bytes.
+ * @param user_data The display.
+ */
+void lv_dirty_area_coalescer_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !LVGL_DIRTY_AREA_COALESCER_H */
@@ -0,0 +1,955 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglDisplayBuffering.cpp
+ * PURPOSE:   Implementation for the buffering layer of LVGL displays
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglDisplayBuffering.h"
+
+#if LV_USE_WINDOWS
+#include <Windows.h>
+#endif
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+typedef struct _lv_display_buffering_job_t
+{
+    // The buffer which contains the area in the partial mode, or the frame in
+    // the direct modes.
+    size_t buffer_index;
+    // The stride of the buffer, which is reshaped to the area by LVGL in the
+    // partial mode.
+    uint32_t stride;
+    std::vector<lv_area_t> areas;
+    bool last;
+    uint64_t queue_time;
+} lv_display_buffering_job_t;
+
+typedef struct _lv_display_buffering_frame_t
+{
+    uint64_t index;
+    std::vector<lv_area_t> areas;
+} lv_display_buffering_frame_t;
+
+typedef struct _lv_display_buffering_context_t
+{
+    lv_display_t* display;
+    lv_display_buffering_mode_t mode;
+    lv_display_buffering_present_cb_t present_cb;
+    void* user_data;
+#if LV_USE_WINDOWS
+    // The window of the Windows display, which is painted from the
+    // framebuffer owned by the context instead of the one of the backend.
+    HWND window_handle;
+#endif
+    lv_draw_buf_t* framebuffer;
+    lv_area_t screen_area;
+    lv_color_format_t color_format;
+    uint32_t pixel_size;
+    std::vector<lv_draw_buf_t*> buffers;
+
+    // Only accessed from the LVGL thread.
+    size_t current_buffer;
+    size_t latest_buffer;
+    // The index of the frame whose content every buffer contains.
+    std::vector<uint64_t> buffer_frames;
+    uint64_t frame_index;
+    // The dirty areas of the recent frames, which are copied to the buffer
+    // the next frame is rendered into.
+    std::deque<lv_display_buffering_frame_t> frames;
+    std::vector<lv_area_t> frame_areas;
+
+    // Guarded by the mutex.
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<bool> presenting;
+    std::deque<lv_display_buffering_job_t> queue;
+    uint32_t queue_capacity;
+    // The number of jobs queued or being presented.
+    uint32_t in_flight_count;
+    // The buffer LVGL renders into next in the partial mode, whose flush is
+    // made ready by the presenter after presenting its previous area.
+    size_t flush_pending_buffer;
+    bool exiting;
+    lv_display_buffering_stats_t stats;
+
+    std::thread presenter;
+} lv_display_buffering_context_t;
+
+// Only accessed from the LVGL thread.
+static std::vector<lv_display_buffering_context_t*>
+    g_display_buffering_contexts;
+static uint32_t g_display_buffering_queue_depth =
+    LV_DISPLAY_BUFFERING_QUEUE_DEPTH;
+
+#if LV_USE_WINDOWS
+
+#define LV_DISPLAY_BUFFERING_WINDOW_PROCEDURE_PROPERTY \
+    L"LvglDisplayBufferingWindowProcedure"
+#define LV_DISPLAY_BUFFERING_CONTEXT_PROPERTY L"LvglDisplayBufferingContext"
+
+// Guards the framebuffers of the windows, which are written by the presenter
+// threads and painted by the window thread of the LVGL Windows backend, and
+// the context properties of the windows.
+static std::mutex g_display_buffering_window_mutex;
+
+#endif
+
+static uint64_t lv_display_buffering_get_time()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+static lv_display_buffering_context_t* lv_display_buffering_find_context(
+    lv_display_t* display)
+{
+    for (lv_display_buffering_context_t* context
+        : g_display_buffering_contexts)
+    {
+        if (display == context->display)
+        {
+            return context;
+        }
+    }
+
+    return NULL;
+}
+
+static uint64_t lv_display_buffering_copy_area(
+    lv_display_buffering_context_t* context,
+    lv_draw_buf_t* destination,
+    const uint8_t* source,
+    uint32_t source_stride,
+    const lv_area_t* source_area,
+    const lv_area_t* area)
+{
+    lv_area_t clipped_area;
+    if (!lv_area_intersect(&clipped_area, area, &context->screen_area))
+    {
+        return 0;
+    }
+
+    size_t row_size =
+        static_cast<size_t>(lv_area_get_width(&clipped_area))
+        * context->pixel_size;
+    const uint8_t* source_row = source
+        + static_cast<size_t>(clipped_area.y1 - source_area->y1)
+            * source_stride
+        + static_cast<size_t>(clipped_area.x1 - source_area->x1)
+            * context->pixel_size;
+    uint8_t* destination_row = destination->data
+        + static_cast<size_t>(clipped_area.y1) * destination->header.stride
+        + static_cast<size_t>(clipped_area.x1) * context->pixel_size;
+    for (int32_t y = clipped_area.y1; y <= clipped_area.y2; ++y)
+    {
+        std::memcpy(destination_row, source_row, row_size);
+        source_row += source_stride;
+        destination_row += destination->header.stride;
+    }
+
+    return lv_area_get_size(&clipped_area);
+}
+
+#if LV_USE_WINDOWS
+static void lv_display_buffering_paint_window(
+    lv_display_buffering_context_t* context,
+    HWND window_handle)
+{
+    PAINTSTRUCT paint;
+    HDC hdc = ::BeginPaint(window_handle, &paint);
+    if (!hdc)
+    {
+        return;
+    }
+
+    RECT client_rect;
+    ::GetClientRect(window_handle, &client_rect);
+
+    // The color masks follow the header for BI_BITFIELDS.
+    struct
+    {
+        BITMAPINFOHEADER header;
+        DWORD masks[3];
+    } bitmap_info = {};
+    bitmap_info.header.biSize = sizeof(BITMAPINFOHEADER);
+    // The stride of the framebuffer is aligned to 4 bytes like the DIBs.
+    bitmap_info.header.biWidth = static_cast<LONG>(
+        lv_area_get_width(&context->screen_area));
+    // A negative height means a top-down bitmap.
+    bitmap_info.header.biHeight =
+        -static_cast<LONG>(lv_area_get_height(&context->screen_area));
+    bitmap_info.header.biPlanes = 1;
+    bitmap_info.header.biBitCount =
+        static_cast<WORD>(context->pixel_size * 8);
+    if (LV_COLOR_FORMAT_RGB565 == context->color_format)
+    {
+        // The 16-bit BI_RGB bitmaps are RGB555.
+        bitmap_info.header.biCompression = BI_BITFIELDS;
+        bitmap_info.masks[0] = 0xF800;
+        bitmap_info.masks[1] = 0x07E0;
+        bitmap_info.masks[2] = 0x001F;
+    }
+    else
+    {
+        bitmap_info.header.biCompression = BI_RGB;
+    }
+
+    ::StretchDIBits(
+        hdc,
+        client_rect.left,
+        client_rect.top,
+        client_rect.right - client_rect.left,
+        client_rect.bottom - client_rect.top,
+        0,
+        0,
+        lv_area_get_width(&context->screen_area),
+        lv_area_get_height(&context->screen_area),
+        context->framebuffer->data,
+        reinterpret_cast<BITMAPINFO*>(&bitmap_info),
+        DIB_RGB_COLORS,
+        SRCCOPY);
+
+    ::EndPaint(window_handle, &paint);
+}
+
+static LRESULT CALLBACK lv_display_buffering_window_procedure(
+    HWND window_handle,
+    UINT message,
+    WPARAM wparam,
+    LPARAM lparam)
+{
+    WNDPROC original_procedure = reinterpret_cast<WNDPROC>(::GetPropW(
+        window_handle,
+        LV_DISPLAY_BUFFERING_WINDOW_PROCEDURE_PROPERTY));
+
+    if (WM_PAINT == message)
+    {
+        std::lock_guard<std::mutex> lock(g_display_buffering_window_mutex);
+        lv_display_buffering_context_t* context =
+            static_cast<lv_display_buffering_context_t*>(::GetPropW(
+                window_handle,
+                LV_DISPLAY_BUFFERING_CONTEXT_PROPERTY));
+        if (context)
+        {
+            lv_display_buffering_paint_window(context, window_handle);
+            return 0;
+        }
+    }
+
+    if (WM_NCDESTROY == message)
+    {
+        ::SetWindowLongPtrW(
+            window_handle,
+            GWLP_WNDPROC,
+            reinterpret_cast<LONG_PTR>(original_procedure));
+        ::RemovePropW(
+            window_handle,
+            LV_DISPLAY_BUFFERING_WINDOW_PROCEDURE_PROPERTY);
+        std::lock_guard<std::mutex> lock(g_display_buffering_window_mutex);
+        ::RemovePropW(window_handle, LV_DISPLAY_BUFFERING_CONTEXT_PROPERTY);
+    }
+
+    return ::CallWindowProcW(
+        original_procedure,
+        window_handle,
+        message,
+        wparam,
+        lparam);
+}
+
+static bool lv_display_buffering_subclass_window(
+    lv_display_buffering_context_t* context)
+{
+    HWND window_handle = context->window_handle;
+
+    if (!::GetPropW(
+        window_handle,
+        LV_DISPLAY_BUFFERING_WINDOW_PROCEDURE_PROPERTY))
+    {
+        LONG_PTR original_procedure = ::GetWindowLongPtrW(
+            window_handle,
+            GWLP_WNDPROC);
+        if (!::SetPropW(
+            window_handle,
+            LV_DISPLAY_BUFFERING_WINDOW_PROCEDURE_PROPERTY,
+            reinterpret_cast<HANDLE>(original_procedure)))
+        {
+            return false;
+        }
+
+        // The window belongs to the window thread of the LVGL Windows
+        // backend, which is in the same process, so it can be subclassed
+        // from here.
+        ::SetWindowLongPtrW(
+            window_handle,
+            GWLP_WNDPROC,
+            reinterpret_cast<LONG_PTR>(
+                lv_display_buffering_window_procedure));
+    }
+
+    std::lock_guard<std::mutex> lock(g_display_buffering_window_mutex);
+    return FALSE != ::SetPropW(
+        window_handle,
+        LV_DISPLAY_BUFFERING_CONTEXT_PROPERTY,
+        context);
+}
+#endif
+
+static void lv_display_buffering_present(
+    lv_display_buffering_context_t* context,
+    const lv_area_t* area)
+{
+    if (context->present_cb)
+    {
+        context->present_cb(context->display, area, context->user_data);
+        return;
+    }
+
+#if LV_USE_WINDOWS
+    if (context->window_handle)
+    {
+        // The window is painted by its own thread, so the presentation is
+        // serialized with the other messages of the window.
+        ::InvalidateRect(context->window_handle, NULL, FALSE);
+    }
+#endif
+}
+
+static void lv_display_buffering_presenter_thread(
+    lv_display_buffering_context_t* context)
+{
+    for (;;)
+    {
+        lv_display_buffering_job_t job;
+        {
+            std::unique_lock<std::mutex> lock(context->mutex);
+            context->condition.wait(lock, [context]()
+            {
+                return !context->queue.empty() || context->exiting;
+            });
+            if (context->queue.empty())
+            {
+                return;
+            }
+            job = std::move(context->queue.front());
+            context->queue.pop_front();
+        }
+
+        lv_draw_buf_t* buffer = context->buffers[job.buffer_index];
+        // The partial buffers only contain the area itself.
+        const lv_area_t* buffer_area =
+            LV_DISPLAY_BUFFERING_MODE_PARTIAL == context->mode
+            ? &job.areas.front()
+            : &context->screen_area;
+        uint64_t pixel_count = 0;
+        lv_area_t bounding_area = job.areas.front();
+#if LV_USE_WINDOWS
+        std::unique_lock<std::mutex> window_lock(
+            g_display_buffering_window_mutex,
+            std::defer_lock);
+        if (context->window_handle)
+        {
+            window_lock.lock();
+        }
+#endif
+        for (const lv_area_t& area : job.areas)
+        {
+            pixel_count += lv_display_buffering_copy_area(
+                context,
+                context->framebuffer,
+                buffer->data,
+                job.stride,
+                buffer_area,
+                &area);
+            lv_area_join(&bounding_area, &bounding_area, &area);
+        }
+#if LV_USE_WINDOWS
+        if (window_lock.owns_lock())
+        {
+            window_lock.unlock();
+        }
+#endif
+
+        if (job.last)
+        {
+            lv_display_buffering_present(context, &bounding_area);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(context->mutex);
+            context->presenting[job.buffer_index] = false;
+            --context->in_flight_count;
+            if (job.buffer_index == context->flush_pending_buffer)
+            {
+                // Made ready with the mutex held, so it can't be mistaken
+                // for the flush of the next area.
+                context->flush_pending_buffer = SIZE_MAX;
+                lv_display_flush_ready(context->display);
+            }
+            if (job.last)
+            {
+                ++context->stats.frame_count;
+            }
+            ++context->stats.completed_count;
+            context->stats.latency_time +=
+                lv_display_buffering_get_time() - job.queue_time;
+            context->stats.area_count += job.areas.size();
+            context->stats.presented_pixel_count += pixel_count;
+        }
+        context->condition.notify_all();
+    }
+}
+
+static void lv_display_buffering_submit(
+    lv_display_buffering_context_t* context,
+    lv_display_buffering_job_t& job)
+{
+    {
+        std::unique_lock<std::mutex> lock(context->mutex);
+        if (context->in_flight_count >= context->queue_capacity)
+        {
+            uint64_t wait_start_time = lv_display_buffering_get_time();
+            context->condition.wait(lock, [context]()
+            {
+                return context->in_flight_count < context->queue_capacity;
+            });
+            ++context->stats.queue_wait_count;
+            context->stats.queue_wait_time +=
+                lv_display_buffering_get_time() - wait_start_time;
+        }
+        context->presenting[job.buffer_index] = true;
+        ++context->in_flight_count;
+        ++context->stats.queued_count;
+        context->stats.max_queue_depth = LV_MAX(
+            context->stats.max_queue_depth,
+            context->in_flight_count);
+        job.queue_time = lv_display_buffering_get_time();
+        context->queue.push_back(std::move(job));
+    }
+    context->condition.notify_all();
+}
+
+static void lv_display_buffering_flush_wait_callback(
+    lv_display_t* display)
+{
+    lv_display_buffering_context_t* context =
+        lv_display_buffering_find_context(display);
+    if (!context)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(context->mutex);
+    if (SIZE_MAX != context->flush_pending_buffer)
+    {
+        uint64_t wait_start_time = lv_display_buffering_get_time();
+        context->condition.wait(lock, [context]()
+        {
+            return SIZE_MAX == context->flush_pending_buffer;
+        });
+        ++context->stats.flush_wait_count;
+        context->stats.flush_wait_time +=
+            lv_display_buffering_get_time() - wait_start_time;
+    }
+}
+
+static void lv_display_buffering_flush_callback(
+    lv_display_t* display,
+    const lv_area_t* area,
+    uint8_t* px_map)
+{
+    // The buffer LVGL renders into is tracked by the layer itself.
+    LV_UNUSED(px_map);
+
+    lv_display_buffering_context_t* context =
+        lv_display_buffering_find_context(display);
+    if (!context)
+    {
+        lv_display_flush_ready(display);
+        return;
+    }
+
+    lv_display_buffering_job_t job;
+    job.buffer_index = context->current_buffer;
+    job.stride = context->buffers[context->current_buffer]->header.stride;
+    job.last = lv_display_flush_is_last(display);
+
+    if (LV_DISPLAY_BUFFERING_MODE_PARTIAL == context->mode)
+    {
+        job.areas.push_back(*area);
+        lv_display_buffering_submit(context, job);
+
+        // Render the next area into the next buffer of the ring, which is the
+        // oldest one being presented if none of them is free. This relies on
+        // LVGL reading the active buffer of the display again for every area
+        // of a refresh, where layer_reshape_draw_buf reshapes it to the area,
+        // and waiting with the flush wait callback before rendering into it,
+        // which is the case for LVGL v9. The native double buffering of LVGL
+        // only alternates between two buffers.
+        context->current_buffer =
+            (context->current_buffer + 1) % context->buffers.size();
+        lv_display_set_draw_buffers(
+            display,
+            context->buffers[context->current_buffer],
+            NULL);
+        {
+            std::lock_guard<std::mutex> lock(context->mutex);
+            if (context->presenting[context->current_buffer])
+            {
+                // The presenter makes the flush ready after presenting the
+                // previous area of the buffer.
+                context->flush_pending_buffer = context->current_buffer;
+                return;
+            }
+        }
+        lv_display_flush_ready(display);
+        return;
+    }
+
+    // The areas of a frame are rendered into the same buffer in the direct
+    // modes, so they are presented together after the last one.
+    context->frame_areas.push_back(*area);
+    if (job.last)
+    {
+        ++context->frame_index;
+        context->buffer_frames[context->current_buffer] =
+            context->frame_index;
+        context->latest_buffer = context->current_buffer;
+
+        lv_display_buffering_frame_t frame;
+        frame.index = context->frame_index;
+        frame.areas = context->frame_areas;
+        context->frames.push_back(std::move(frame));
+        while (context->frames.size() > context->buffers.size())
+        {
+            context->frames.pop_front();
+        }
+
+        job.areas = std::move(context->frame_areas);
+        context->frame_areas.clear();
+        lv_display_buffering_submit(context, job);
+    }
+
+    // The next frame is rendered into another buffer, which is selected when
+    // the next refresh starts.
+    lv_display_flush_ready(display);
+}
+
+static void lv_display_buffering_sync_buffer(
+    lv_display_buffering_context_t* context,
+    size_t buffer_index)
+{
+    lv_draw_buf_t* source = context->buffers[context->latest_buffer];
+    lv_draw_buf_t* destination = context->buffers[buffer_index];
+    uint64_t buffer_frame = context->buffer_frames[buffer_index];
+
+    std::vector<const lv_area_t*> areas;
+    uint64_t pixel_count = 0;
+    bool complete = !context->frames.empty()
+        && context->frames.front().index <= buffer_frame + 1;
+    for (const lv_display_buffering_frame_t& frame : context->frames)
+    {
+        if (frame.index <= buffer_frame)
+        {
+            continue;
+        }
+        for (const lv_area_t& area : frame.areas)
+        {
+            areas.push_back(&area);
+            pixel_count += lv_area_get_size(&area);
+        }
+    }
+
+    // Copy the whole screen once instead if the recent frames are not known
+    // or their areas overlap too much.
+    if (!complete || pixel_count >= lv_area_get_size(&context->screen_area))
+    {
+        areas.clear();
+        areas.push_back(&context->screen_area);
+    }
+
+    pixel_count = 0;
+    for (const lv_area_t* area : areas)
+    {
+        pixel_count += lv_display_buffering_copy_area(
+            context,
+            destination,
+            source->data,
+            source->header.stride,
+            &context->screen_area,
+            area);
+    }
+    context->buffer_frames[buffer_index] = context->frame_index;
+
+    std::lock_guard<std::mutex> lock(context->mutex);
+    context->stats.synced_pixel_count += pixel_count;
+}
+
+static void lv_display_buffering_refr_start(
+    lv_display_buffering_context_t* context)
+{
+    if (LV_DISPLAY_BUFFERING_MODE_PARTIAL == context->mode
+        || context->current_buffer != context->latest_buffer)
+    {
+        return;
+    }
+
+    // Select the least recently rendered buffer which is neither the latest
+    // frame nor being presented, which only blocks if the presenter is behind
+    // by more than the number of buffers.
+    size_t buffer_index = SIZE_MAX;
+    {
+        std::unique_lock<std::mutex> lock(context->mutex);
+        auto select = [context, &buffer_index]()
+        {
+            for (size_t i = 0; i < context->buffers.size(); ++i)
+            {
+                if (i == context->latest_buffer || context->presenting[i])
+                {
+                    continue;
+                }
+                if (SIZE_MAX == buffer_index
+                    || context->buffer_frames[i]
+                        < context->buffer_frames[buffer_index])
+                {
+                    buffer_index = i;
+                }
+            }
+            return SIZE_MAX != buffer_index;
+        };
+        if (!select())
+        {
+            uint64_t wait_start_time = lv_display_buffering_get_time();
+            context->condition.wait(lock, select);
+            ++context->stats.buffer_wait_count;
+            context->stats.buffer_wait_time +=
+                lv_display_buffering_get_time() - wait_start_time;
+        }
+    }
+
+    // The areas rendered since the buffer was used last time are not
+    // rendered again, so they are copied from the latest frame.
+    lv_display_buffering_sync_buffer(context, buffer_index);
+
+    context->current_buffer = buffer_index;
+    lv_display_set_draw_buffers(
+        context->display,
+        context->buffers[buffer_index],
+        NULL);
+}
+
+static void lv_display_buffering_destroy_context(
+    lv_display_buffering_context_t* context)
+{
+    if (context->presenter.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(context->mutex);
+            context->exiting = true;
+        }
+        context->condition.notify_all();
+        context->presenter.join();
+    }
+
+#if LV_USE_WINDOWS
+    if (context->window_handle)
+    {
+        {
+            std::lock_guard<std::mutex> lock(g_display_buffering_window_mutex);
+            if (context == ::GetPropW(
+                context->window_handle,
+                LV_DISPLAY_BUFFERING_CONTEXT_PROPERTY))
+            {
+                ::RemovePropW(
+                    context->window_handle,
+                    LV_DISPLAY_BUFFERING_CONTEXT_PROPERTY);
+            }
+        }
+        if (context->framebuffer)
+        {
+            lv_draw_buf_destroy(context->framebuffer);
+        }
+    }
+#endif
+
+    for (lv_draw_buf_t* buffer : context->buffers)
+    {
+        lv_draw_buf_destroy(buffer);
+    }
+
+    delete context;
+}
+
+static void lv_display_buffering_display_event_callback(
+    lv_event_t* e)
+{
+    lv_display_buffering_context_t* context =
+        static_cast<lv_display_buffering_context_t*>(
+            lv_event_get_user_data(e));
+
+    switch (lv_event_get_code(e))
+    {
+    case LV_EVENT_REFR_START:
+        lv_display_buffering_refr_start(context);
+        break;
+    case LV_EVENT_DELETE:
+        for (size_t i = 0; i < g_display_buffering_contexts.size(); ++i)
+        {
+            if (context == g_display_buffering_contexts[i])
+            {
+                g_display_buffering_contexts.erase(
+                    g_display_buffering_contexts.begin() + i);
+                break;
+            }
+        }
+        lv_display_buffering_destroy_context(context);
+        break;
+    default:
+        break;
+    }
+}
+
+bool lv_display_buffering_set_queue_depth(
+    uint32_t depth)
+{
+    if (!depth)
+    {
+        return false;
+    }
+
+    g_display_buffering_queue_depth = depth;
+
+    return true;
+}
+
+bool lv_display_buffering_attach_display(
+    lv_display_t* display,
+    lv_display_buffering_mode_t mode,
+    lv_display_buffering_present_cb_t present_cb,
+    void* user_data)
+{
+    if (!display || lv_display_buffering_find_context(display))
+    {
+        return false;
+    }
+
+    lv_draw_buf_t* framebuffer = lv_display_get_buf_active(display);
+    int32_t hor_res = lv_display_get_horizontal_resolution(display);
+    int32_t ver_res = lv_display_get_vertical_resolution(display);
+    lv_color_format_t color_format = lv_display_get_color_format(display);
+    if (!framebuffer
+        || static_cast<int32_t>(framebuffer->header.w) < hor_res
+        || static_cast<int32_t>(framebuffer->header.h) < ver_res)
+    {
+        return false;
+    }
+
+    size_t buffer_count = 2;
+    uint32_t buffer_height = static_cast<uint32_t>(ver_res);
+    switch (mode)
+    {
+    case LV_DISPLAY_BUFFERING_MODE_PARTIAL:
+        // One buffer is rendered while the others are queued.
+        buffer_count = g_display_buffering_queue_depth + 1;
+        buffer_height = static_cast<uint32_t>(LV_MAX(
+            ver_res / LV_DISPLAY_BUFFERING_PARTIAL_DIVISOR,
+            1));
+        break;
+    case LV_DISPLAY_BUFFERING_MODE_DOUBLE:
+        break;
+    case LV_DISPLAY_BUFFERING_MODE_TRIPLE:
+        buffer_count = 3;
+        break;
+    default:
+        return false;
+    }
+
+    lv_display_buffering_context_t* context =
+        new lv_display_buffering_context_t();
+    context->display = display;
+    context->mode = mode;
+    context->present_cb = present_cb;
+    context->user_data = user_data;
+    context->framebuffer = framebuffer;
+    lv_area_set(&context->screen_area, 0, 0, hor_res - 1, ver_res - 1);
+    context->color_format = color_format;
+    context->pixel_size = lv_color_format_get_size(color_format);
+#if LV_USE_WINDOWS
+    if (!present_cb)
+    {
+        context->window_handle = lv_windows_get_display_window_handle(display);
+    }
+    if (context->window_handle)
+    {
+        // The framebuffer of the backend is painted by the window thread
+        // without any lock, so the window is painted from a framebuffer of
+        // its own instead, whose stride is aligned like the DIBs.
+        context->framebuffer = lv_draw_buf_create(
+            static_cast<uint32_t>(hor_res),
+            static_cast<uint32_t>(ver_res),
+            color_format,
+            (static_cast<uint32_t>(hor_res) * context->pixel_size + 3) & ~3U);
+        if (!context->framebuffer)
+        {
+            lv_display_buffering_destroy_context(context);
+            return false;
+        }
+        lv_draw_buf_clear(context->framebuffer, NULL);
+    }
+#endif
+    context->queue_capacity = g_display_buffering_queue_depth;
+    context->flush_pending_buffer = SIZE_MAX;
+    context->stats.mode = mode;
+    context->stats.queue_capacity = g_display_buffering_queue_depth;
+
+    for (size_t i = 0; i < buffer_count; ++i)
+    {
+        lv_draw_buf_t* buffer = lv_draw_buf_create(
+            static_cast<uint32_t>(hor_res),
+            buffer_height,
+            color_format,
+            LV_STRIDE_AUTO);
+        if (!buffer)
+        {
+            lv_display_buffering_destroy_context(context);
+            return false;
+        }
+        context->buffers.push_back(buffer);
+    }
+
+    context->buffer_frames.resize(buffer_count, 0);
+    context->presenting.resize(buffer_count, false);
+    context->latest_buffer = SIZE_MAX;
+
+#if LV_USE_WINDOWS
+    if (context->window_handle
+        && !lv_display_buffering_subclass_window(context))
+    {
+        lv_display_buffering_destroy_context(context);
+        return false;
+    }
+#endif
+
+    g_display_buffering_contexts.push_back(context);
+
+    lv_display_set_flush_cb(display, lv_display_buffering_flush_callback);
+    // LVGL renders into a single buffer, which is switched by the layer
+    // itself after every area in the partial mode or every refresh in the
+    // direct modes, so more than two buffers can be used.
+    lv_display_set_draw_buffers(display, context->buffers[0], NULL);
+    if (LV_DISPLAY_BUFFERING_MODE_PARTIAL == mode)
+    {
+        lv_display_set_flush_wait_cb(
+            display,
+            lv_display_buffering_flush_wait_callback);
+        lv_display_set_render_mode(
+            display,
+            LV_DISPLAY_RENDER_MODE_PARTIAL);
+    }
+    else
+    {
+        lv_display_set_render_mode(
+            display,
+            LV_DISPLAY_RENDER_MODE_DIRECT);
+    }
+
+    // The content of the framebuffer is unknown to the new buffers.
+    lv_obj_invalidate(lv_display_get_screen_active(display));
+
+    lv_display_add_event_cb(
+        display,
+        lv_display_buffering_display_event_callback,
+        LV_EVENT_REFR_START,
+        context);
+    lv_display_add_event_cb(
+        display,
+        lv_display_buffering_display_event_callback,
+        LV_EVENT_DELETE,
+        context);
+
+    context->presenter = std::thread(
+        lv_display_buffering_presenter_thread,
+        context);
+
+    return true;
+}
+
+bool lv_display_buffering_get_stats(
+    lv_display_t* display,
+    lv_display_buffering_stats_t* stats)
+{
+    if (!stats)
+    {
+        return false;
+    }
+
+    lv_display_buffering_context_t* context =
+        lv_display_buffering_find_context(display);
+    if (!context)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(context->mutex);
+    *stats = context->stats;
+
+    return true;
+}
+
+void lv_display_buffering_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data)
+{
+    lv_display_buffering_stats_t stats;
+    if (!buffer
+        || !buffer_size
+        || !lv_display_buffering_get_stats(
+            static_cast<lv_display_t*>(user_data),
+            &stats))
+    {
+        return;
+    }
+
+    static const char* mode_names[] =
+    {
+        "partial",
+        "double",
+        "triple"
+    };
+
+    std::snprintf(
+        buffer,
+        buffer_size,
+        "%s, %llu frames, %u/%u max queued, %llu us latency, "
+        "waits %llu queue (%llu ms), %llu flush (%llu ms), "
+        "%llu buffer (%llu ms), %llu kpx synced",
+        mode_names[stats.mode],
+        static_cast<unsigned long long>(stats.frame_count),
+        stats.max_queue_depth,
+        stats.queue_capacity,
+        static_cast<unsigned long long>(
+            stats.completed_count
+            ? stats.latency_time / stats.completed_count
+            : 0),
+        static_cast<unsigned long long>(stats.queue_wait_count),
+        static_cast<unsigned long long>(stats.queue_wait_time / 1000),
+        static_cast<unsigned long long>(stats.flush_wait_count),
+        static_cast<unsigned long long>(stats.flush_wait_time / 1000),
+        static_cast<unsigned long long>(stats.buffer_wait_count),
+        static_cast<unsigned long long>(stats.buffer_wait_time / 1000),
+        static_cast<unsigned long long>(stats.synced_pixel_count / 1000));
+}
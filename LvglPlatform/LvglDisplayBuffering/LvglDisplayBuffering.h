@@ -0,0 +1,172 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglDisplayBuffering.h
+ * PURPOSE:   Definition for the buffering layer of LVGL displays
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#ifndef LVGL_DISPLAY_BUFFERING_H
+#define LVGL_DISPLAY_BUFFERING_H
+
+#include "lvgl/lvgl.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The height of the partial buffers as a fraction of the vertical
+ *        resolution of the display.
+ */
+#ifndef LV_DISPLAY_BUFFERING_PARTIAL_DIVISOR
+#define LV_DISPLAY_BUFFERING_PARTIAL_DIVISOR 10
+#endif
+
+/**
+ * @brief The default maximum number of areas or frames queued or being
+ *        presented at the same time.
+ */
+#ifndef LV_DISPLAY_BUFFERING_QUEUE_DEPTH
+#define LV_DISPLAY_BUFFERING_QUEUE_DEPTH 2
+#endif
+
+typedef enum _lv_display_buffering_mode_t
+{
+    // The areas are rendered into a ring of small buffers, one more than the
+    // queue depth, and copied to the framebuffer of the display by the
+    // presenter.
+    LV_DISPLAY_BUFFERING_MODE_PARTIAL,
+    // The frames are rendered into two full size buffers in turn, and the
+    // dirty areas are copied to the framebuffer of the display by the
+    // presenter.
+    LV_DISPLAY_BUFFERING_MODE_DOUBLE,
+    // Like LV_DISPLAY_BUFFERING_MODE_DOUBLE, but with three buffers, so the
+    // next frame can be rendered even if the presenter is still busy with the
+    // previous one.
+    LV_DISPLAY_BUFFERING_MODE_TRIPLE,
+} lv_display_buffering_mode_t;
+
+/**
+ * @brief The callback which shows the framebuffer of the display to the user
+ *        after the areas of a frame are copied into it.
+ * @param display The display.
+ * @param area The bounding box of the areas of the frame.
+ * @param user_data The user data passed to lv_display_buffering_attach_display.
+ * @remark It is called from the presenter thread of the display.
+ */
+typedef void (*lv_display_buffering_present_cb_t)(
+    lv_display_t* display,
+    const lv_area_t* area,
+    void* user_data);
+
+typedef struct _lv_display_buffering_stats_t
+{
+    lv_display_buffering_mode_t mode;
+    uint64_t frame_count;
+    // The number of areas copied to the framebuffer of the display.
+    uint64_t area_count;
+    // The number of pixels copied to the framebuffer of the display.
+    uint64_t presented_pixel_count;
+    // The number of pixels copied between the buffers to keep the areas which
+    // are not rendered in the current frame up to date.
+    uint64_t synced_pixel_count;
+    // The maximum number of areas or frames in the queue of the presenter.
+    uint32_t queue_capacity;
+    // The maximum number of areas or frames queued or being presented at the
+    // same time so far.
+    uint32_t max_queue_depth;
+    // The number of areas queued in the partial mode, or frames queued in the
+    // direct modes.
+    uint64_t queued_count;
+    uint64_t completed_count;
+    // The total time in microseconds from queuing the completed areas or
+    // frames to finishing presenting them.
+    uint64_t latency_time;
+    // The number of times the queue was full when queuing, and the total time
+    // in microseconds the LVGL thread waited for a free slot.
+    uint64_t queue_wait_count;
+    uint64_t queue_wait_time;
+    // The number of times the LVGL thread waited in the flush wait callback
+    // for the next partial buffer to be presented, and the total time in
+    // microseconds.
+    uint64_t flush_wait_count;
+    uint64_t flush_wait_time;
+    // The number of times the LVGL thread waited for a buffer to render the
+    // next frame into in the direct modes, because all other buffers were
+    // still being presented, and the total time in microseconds.
+    uint64_t buffer_wait_count;
+    uint64_t buffer_wait_time;
+} lv_display_buffering_stats_t;
+
+/**
+ * @brief Sets the maximum number of areas or frames queued or being presented
+ *        at the same time, which is LV_DISPLAY_BUFFERING_QUEUE_DEPTH by
+ *        default.
+ * @param depth The queue depth.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark It must be called before attaching any display. In the direct modes
+ *         the queue depth is also limited by the number of buffers.
+ */
+bool lv_display_buffering_set_queue_depth(
+    uint32_t depth);
+
+/**
+ * @brief Renders the display into the buffers of the specified mode, and
+ *        queues the rendered areas to a presenter thread, which copies them
+ *        to the framebuffer of the display and makes the flush ready, so the
+ *        next area or frame is rendered while the previous one is presented.
+ * @param display The display, which must be in the direct render mode with
+ *                a full size framebuffer, e.g. the Windows or headless
+ *                displays.
+ * @param mode The buffering mode.
+ * @param present_cb The callback which shows the framebuffer of the display
+ *                   after every frame. NULL means redrawing the window of the
+ *                   Windows display, or nothing for the other displays.
+ * @param user_data The user data passed to the present callback.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark The framebuffer is the active buffer of the display when attaching,
+ *         and the resolution of the display must not be changed later, so use
+ *         the simulator mode for the Windows displays. Without the present
+ *         callback, the Windows displays get a framebuffer of their own
+ *         instead, which is painted by the window thread, so the presenter
+ *         never races with the painting of the backend.
+ */
+bool lv_display_buffering_attach_display(
+    lv_display_t* display,
+    lv_display_buffering_mode_t mode,
+    lv_display_buffering_present_cb_t present_cb,
+    void* user_data);
+
+/**
+ * @brief Gets the statistics of the buffering layer of the display.
+ * @param display The display.
+ * @param stats The statistics.
+ * @return If succeed, return true. Otherwise, return false.
+ */
+bool lv_display_buffering_get_stats(
+    lv_display_t* display,
+    lv_display_buffering_stats_t* stats);
+
+/**
+ * @brief Formats the statistics of the buffering layer of a display as a
+ *        single line of text, which can be used as the callback of
+ *        lv_stats_monitor_add_source.
+ * @param buffer The buffer which receives the formatted statistics.
+ * @param buffer_size The size of the buffer in bytes.
+ * @param user_data The display.
+ */
+void lv_display_buffering_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !LVGL_DISPLAY_BUFFERING_H */
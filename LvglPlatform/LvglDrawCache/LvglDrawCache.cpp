@@ -0,0 +1,297 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglDrawCache.cpp
+ * PURPOSE:   Implementation for the unified LVGL draw cache budget and telemetry
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglDrawCache.h"
+#include "LvglCircleCache.h"
+#include "LvglShadowCache.h"
+
+#include "lvgl/src/lvgl_private.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+
+typedef struct _lv_draw_cache_counter_t
+{
+    lv_cache_t* cache;
+    const lv_cache_class_t* original_class;
+    lv_cache_class_t counting_class;
+    std::atomic<uint64_t> hit_count;
+    std::atomic<uint64_t> miss_count;
+    std::atomic<uint64_t> eviction_count;
+} lv_draw_cache_counter_t;
+
+// The counters of LV_DRAW_CACHE_TYPE_IMAGE and LV_DRAW_CACHE_TYPE_IMAGE_HEADER.
+static lv_draw_cache_counter_t g_draw_cache_counters[2];
+
+static const char* const g_draw_cache_names[LV_DRAW_CACHE_TYPE_COUNT] =
+{
+    "Image cache",
+    "Image header cache",
+    "Shadow cache",
+    "Circle cache"
+};
+
+static lv_draw_cache_counter_t* lv_draw_cache_find_counter(
+    lv_cache_t* cache)
+{
+    for (lv_draw_cache_counter_t& counter : g_draw_cache_counters)
+    {
+        if (counter.cache == cache)
+        {
+            return &counter;
+        }
+    }
+
+    return NULL;
+}
+
+static lv_cache_entry_t* lv_draw_cache_get_callback(
+    lv_cache_t* cache,
+    const void* key,
+    void* user_data)
+{
+    lv_draw_cache_counter_t* counter = lv_draw_cache_find_counter(cache);
+
+    lv_cache_entry_t* entry =
+        counter->original_class->get_cb(cache, key, user_data);
+    if (entry)
+    {
+        ++counter->hit_count;
+    }
+    else
+    {
+        ++counter->miss_count;
+    }
+
+    return entry;
+}
+
+static lv_cache_entry_t* lv_draw_cache_get_victim_callback(
+    lv_cache_t* cache,
+    void* user_data)
+{
+    lv_draw_cache_counter_t* counter = lv_draw_cache_find_counter(cache);
+
+    // LVGL only asks for a victim when it's going to evict it.
+    lv_cache_entry_t* entry =
+        counter->original_class->get_victim_cb(cache, user_data);
+    if (entry)
+    {
+        ++counter->eviction_count;
+    }
+
+    return entry;
+}
+
+static bool lv_draw_cache_install_counter(
+    lv_draw_cache_counter_t* counter,
+    lv_cache_t* cache)
+{
+    if (!cache)
+    {
+        return false;
+    }
+
+    if (counter->cache == cache)
+    {
+        return true;
+    }
+
+    counter->cache = cache;
+    counter->original_class = cache->clz;
+    counter->counting_class = *cache->clz;
+    counter->counting_class.get_cb = lv_draw_cache_get_callback;
+    counter->counting_class.get_victim_cb = lv_draw_cache_get_victim_callback;
+    counter->hit_count = 0;
+    counter->miss_count = 0;
+    counter->eviction_count = 0;
+
+    lv_mutex_lock(&cache->lock);
+    cache->clz = &counter->counting_class;
+    lv_mutex_unlock(&cache->lock);
+
+    return true;
+}
+
+bool lv_draw_cache_init(
+    size_t budget)
+{
+    if (!lv_draw_cache_install_counter(
+        &g_draw_cache_counters[LV_DRAW_CACHE_TYPE_IMAGE],
+        LV_GLOBAL_DEFAULT()->img_cache))
+    {
+        return false;
+    }
+
+    if (!lv_draw_cache_install_counter(
+        &g_draw_cache_counters[LV_DRAW_CACHE_TYPE_IMAGE_HEADER],
+        LV_GLOBAL_DEFAULT()->img_header_cache))
+    {
+        return false;
+    }
+
+    return lv_draw_cache_set_budget(budget);
+}
+
+bool lv_draw_cache_set_budget(
+    size_t budget)
+{
+    size_t shadow_budget = budget / 8;
+    size_t circle_budget = budget / 32;
+    size_t header_count = budget / (64 * 1024);
+    size_t image_budget = budget - shadow_budget - circle_budget;
+
+    if (image_budget > UINT32_MAX)
+    {
+        return false;
+    }
+
+    lv_image_cache_resize(static_cast<uint32_t>(image_budget), true);
+    lv_image_header_cache_resize(static_cast<uint32_t>(header_count), true);
+    lv_shadow_cache_set_budget(shadow_budget);
+    lv_circle_cache_set_budget(circle_budget);
+
+    return true;
+}
+
+bool lv_draw_cache_get_stats(
+    lv_draw_cache_type_t type,
+    lv_draw_cache_stats_t* stats)
+{
+    if (!stats)
+    {
+        return false;
+    }
+
+    switch (type)
+    {
+    case LV_DRAW_CACHE_TYPE_IMAGE:
+    case LV_DRAW_CACHE_TYPE_IMAGE_HEADER:
+    {
+        const lv_draw_cache_counter_t& counter = g_draw_cache_counters[type];
+        if (!counter.cache)
+        {
+            return false;
+        }
+
+        stats->sized_in_entries = LV_DRAW_CACHE_TYPE_IMAGE_HEADER == type;
+        stats->size = lv_cache_get_size(counter.cache, NULL);
+        stats->max_size = lv_cache_get_max_size(counter.cache, NULL);
+        stats->hit_count = counter.hit_count;
+        stats->miss_count = counter.miss_count;
+        stats->eviction_count = counter.eviction_count;
+        break;
+    }
+    case LV_DRAW_CACHE_TYPE_SHADOW:
+    {
+        lv_shadow_cache_stats_t shadow_stats;
+        if (!lv_shadow_cache_get_stats(&shadow_stats))
+        {
+            return false;
+        }
+
+        stats->sized_in_entries = false;
+        stats->size = shadow_stats.used_size;
+        stats->max_size = shadow_stats.budget;
+        stats->hit_count = shadow_stats.hit_count;
+        stats->miss_count = shadow_stats.miss_count;
+        stats->eviction_count = shadow_stats.eviction_count;
+        break;
+    }
+    case LV_DRAW_CACHE_TYPE_CIRCLE:
+    {
+        lv_circle_cache_stats_t circle_stats;
+        if (!lv_circle_cache_get_stats(&circle_stats))
+        {
+            return false;
+        }
+
+        stats->sized_in_entries = false;
+        stats->size = circle_stats.used_size;
+        stats->max_size = circle_stats.budget;
+        stats->hit_count = circle_stats.hit_count;
+        stats->miss_count = circle_stats.miss_count;
+        stats->eviction_count = circle_stats.eviction_count;
+        break;
+    }
+    default:
+        return false;
+    }
+
+    stats->name = g_draw_cache_names[type];
+
+    return true;
+}
+
+void lv_draw_cache_dump(void)
+{
+    std::printf(
+        "%-20s %12s %12s %6s %12s %12s %12s\n",
+        "cache",
+        "size",
+        "max_size",
+        "unit",
+        "hits",
+        "misses",
+        "evictions");
+
+    for (int i = 0; i < LV_DRAW_CACHE_TYPE_COUNT; ++i)
+    {
+        lv_draw_cache_stats_t stats;
+        if (!lv_draw_cache_get_stats(
+            static_cast<lv_draw_cache_type_t>(i),
+            &stats))
+        {
+            continue;
+        }
+
+        std::printf(
+            "%-20s %12zu %12zu %6s %12llu %12llu %12llu\n",
+            stats.name,
+            stats.size,
+            stats.max_size,
+            stats.sized_in_entries ? "entry" : "byte",
+            static_cast<unsigned long long>(stats.hit_count),
+            static_cast<unsigned long long>(stats.miss_count),
+            static_cast<unsigned long long>(stats.eviction_count));
+    }
+}
+
+void lv_draw_cache_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data)
+{
+    lv_draw_cache_stats_t stats;
+    if (!buffer || !buffer_size || !lv_draw_cache_get_stats(
+        static_cast<lv_draw_cache_type_t>(
+            reinterpret_cast<uintptr_t>(user_data)),
+        &stats))
+    {
+        return;
+    }
+
+    uint64_t lookup_count = stats.hit_count + stats.miss_count;
+    std::snprintf(
+        buffer,
+        buffer_size,
+        stats.sized_in_entries
+            ? "%zu/%zu entries, %llu hits (%u%%), %llu misses, %llu evictions"
+            : "%zu/%zu bytes, %llu hits (%u%%), %llu misses, %llu evictions",
+        stats.size,
+        stats.max_size,
+        static_cast<unsigned long long>(stats.hit_count),
+        lookup_count
+            ? static_cast<uint32_t>(stats.hit_count * 100 / lookup_count)
+            : 0,
+        static_cast<unsigned long long>(stats.miss_count),
+        static_cast<unsigned long long>(stats.eviction_count));
+}
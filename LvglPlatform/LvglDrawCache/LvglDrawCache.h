@@ -0,0 +1,113 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglDrawCache.h
+ * PURPOSE:   Definition for the unified LVGL draw cache budget and telemetry
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#ifndef LVGL_DRAW_CACHE_H
+#define LVGL_DRAW_CACHE_H
+
+#include "lvgl/lvgl.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The default unified budget in bytes of the draw caches.
+ */
+#ifndef LV_DRAW_CACHE_SIZE
+#define LV_DRAW_CACHE_SIZE (8 * 1024 * 1024)
+#endif
+
+typedef enum _lv_draw_cache_type_t
+{
+    // The decoded images cached by LVGL, sized in bytes.
+    LV_DRAW_CACHE_TYPE_IMAGE,
+    // The image headers cached by LVGL, sized in entries.
+    LV_DRAW_CACHE_TYPE_IMAGE_HEADER,
+    // The box shadow masks cached by LvglShadowCache, sized in bytes.
+    LV_DRAW_CACHE_TYPE_SHADOW,
+    // The rounded corner masks cached by LvglCircleCache, sized in bytes.
+    LV_DRAW_CACHE_TYPE_CIRCLE,
+    LV_DRAW_CACHE_TYPE_COUNT
+} lv_draw_cache_type_t;
+
+typedef struct _lv_draw_cache_stats_t
+{
+    const char* name;
+    // Whether the size and the maximum size are in entries instead of bytes.
+    bool sized_in_entries;
+    size_t size;
+    size_t max_size;
+    uint64_t hit_count;
+    uint64_t miss_count;
+    uint64_t eviction_count;
+} lv_draw_cache_stats_t;
+
+/**
+ * @brief Starts counting the hits, the misses and the evictions of the image
+ *        caches of LVGL, and applies the unified budget to all draw caches.
+ * @param budget The unified budget in bytes. See lv_draw_cache_set_budget.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark This function should be called after lv_init. The image caches of
+ *         LVGL don't have counters, so the lookups and the victim selections
+ *         of their cache classes are wrapped.
+ */
+bool lv_draw_cache_init(
+    size_t budget);
+
+/**
+ * @brief Splits the unified budget among the draw caches. The shadow cache
+ *        gets 1/8 of the budget, the circle cache gets 1/32 of the budget, the
+ *        image header cache gets one entry for every 64 KiB of the budget, and
+ *        the image cache gets the rest.
+ * @param budget The unified budget in bytes. 0 means all draw caches are
+ *               disabled.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark The entries exceeding the new budgets are evicted immediately. LVGL
+ *         has no gradient cache, and the glyphs of the built-in fonts are not
+ *         decoded, so they are not covered by the budget.
+ */
+bool lv_draw_cache_set_budget(
+    size_t budget);
+
+/**
+ * @brief Gets the statistics of a draw cache.
+ * @param type The type of the draw cache.
+ * @param stats The statistics of the draw cache.
+ * @return If succeed, return true. Otherwise, return false.
+ */
+bool lv_draw_cache_get_stats(
+    lv_draw_cache_type_t type,
+    lv_draw_cache_stats_t* stats);
+
+/**
+ * @brief Prints the state of all draw caches to the standard output as a
+ *        table.
+ */
+void lv_draw_cache_dump(void);
+
+/**
+ * @brief Formats the statistics of a draw cache as a single line of text,
+ *        which can be used as the callback of lv_stats_monitor_add_source.
+ * @param buffer The buffer which receives the formatted statistics.
+ * @param buffer_size The size of the buffer in bytes.
+ * @param user_data The type of the draw cache cast to a pointer.
+ */
+void lv_draw_cache_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !LVGL_DRAW_CACHE_H */
@@ -0,0 +1,331 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglFrameHistogram.cpp
+ * PURPOSE:   Implementation for the frame time histograms of LVGL displays
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglFrameHistogram.h"
+
+#include <LvglFrameTiming.h>
+
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+// The values smaller than the sub-bucket count are recorded exactly, and every
+// power of 2 from there up to 2^31 is split into the linear sub-buckets, like
+// the HDR histograms with one significant hexadecimal digit.
+#define LV_FRAME_HISTOGRAM_SUB_BUCKET_BITS 4
+#define LV_FRAME_HISTOGRAM_BUCKET_COUNT \
+    ((32 - LV_FRAME_HISTOGRAM_SUB_BUCKET_BITS + 1) \
+        * LV_FRAME_HISTOGRAM_SUB_BUCKET_COUNT)
+
+static_assert(
+    LV_FRAME_HISTOGRAM_SUB_BUCKET_COUNT
+        == (1 << LV_FRAME_HISTOGRAM_SUB_BUCKET_BITS),
+    "The sub-bucket count must match the sub-bucket bits.");
+
+typedef struct _lv_frame_histogram_t
+{
+    uint32_t buckets[LV_FRAME_HISTOGRAM_BUCKET_COUNT];
+    uint32_t count;
+    uint64_t sum;
+    uint32_t max;
+} lv_frame_histogram_t;
+
+static struct
+{
+    std::mutex mutex;
+    lv_frame_histogram_t histograms[LV_FRAME_HISTOGRAM_TYPE_COUNT];
+} g_frame_histogram;
+
+static uint32_t lv_frame_histogram_get_bucket_index(
+    uint32_t value)
+{
+    if (value < LV_FRAME_HISTOGRAM_SUB_BUCKET_COUNT)
+    {
+        return value;
+    }
+
+    uint32_t exponent = 0;
+    while (value >> (exponent + 1))
+    {
+        ++exponent;
+    }
+
+    uint32_t shift = exponent - LV_FRAME_HISTOGRAM_SUB_BUCKET_BITS;
+    uint32_t sub_bucket =
+        (value >> shift) & (LV_FRAME_HISTOGRAM_SUB_BUCKET_COUNT - 1);
+    return (shift + 1) * LV_FRAME_HISTOGRAM_SUB_BUCKET_COUNT + sub_bucket;
+}
+
+static uint32_t lv_frame_histogram_get_bucket_upper_bound(
+    uint32_t index)
+{
+    if (index < LV_FRAME_HISTOGRAM_SUB_BUCKET_COUNT)
+    {
+        return index;
+    }
+
+    uint32_t shift = index / LV_FRAME_HISTOGRAM_SUB_BUCKET_COUNT - 1;
+    uint64_t lower_bound = static_cast<uint64_t>(
+        LV_FRAME_HISTOGRAM_SUB_BUCKET_COUNT
+            + index % LV_FRAME_HISTOGRAM_SUB_BUCKET_COUNT) << shift;
+    return static_cast<uint32_t>(lower_bound + (1ULL << shift) - 1);
+}
+
+static void lv_frame_histogram_record(
+    lv_frame_histogram_t& histogram,
+    uint64_t time)
+{
+    uint32_t value = static_cast<uint32_t>(LV_MIN(time, UINT32_MAX));
+    ++histogram.buckets[lv_frame_histogram_get_bucket_index(value)];
+    ++histogram.count;
+    histogram.sum += value;
+    histogram.max = LV_MAX(histogram.max, value);
+}
+
+static uint32_t lv_frame_histogram_get_percentile(
+    const lv_frame_histogram_t& histogram,
+    uint32_t percent)
+{
+    // The rank of the percentile, rounded up, so p99 of 100 frames is the
+    // 99th frame rather than the 100th.
+    uint64_t rank = (static_cast<uint64_t>(histogram.count) * percent + 99)
+        / 100;
+    rank = LV_MAX(rank, 1ULL);
+
+    uint64_t accumulated = 0;
+    for (uint32_t i = 0; i < LV_FRAME_HISTOGRAM_BUCKET_COUNT; ++i)
+    {
+        accumulated += histogram.buckets[i];
+        if (accumulated >= rank)
+        {
+            return LV_MIN(
+                lv_frame_histogram_get_bucket_upper_bound(i),
+                histogram.max);
+        }
+    }
+
+    return histogram.max;
+}
+
+static void lv_frame_histogram_get_stats(
+    const lv_frame_histogram_t& histogram,
+    lv_frame_histogram_stats_t* stats)
+{
+    std::memset(stats, 0, sizeof(lv_frame_histogram_stats_t));
+    if (!histogram.count)
+    {
+        return;
+    }
+
+    stats->frame_count = histogram.count;
+    stats->avg_time = static_cast<uint32_t>(histogram.sum / histogram.count);
+    stats->p50_time = lv_frame_histogram_get_percentile(histogram, 50);
+    stats->p95_time = lv_frame_histogram_get_percentile(histogram, 95);
+    stats->p99_time = lv_frame_histogram_get_percentile(histogram, 99);
+    stats->max_time = histogram.max;
+}
+
+static void lv_frame_histogram_frame_finished(
+    const lv_frame_timing_frame_t& frame)
+{
+    std::lock_guard<std::mutex> lock(g_frame_histogram.mutex);
+    lv_frame_histogram_record(
+        g_frame_histogram.histograms[LV_FRAME_HISTOGRAM_TYPE_REFR],
+        frame.refr_time);
+    lv_frame_histogram_record(
+        g_frame_histogram.histograms[LV_FRAME_HISTOGRAM_TYPE_RENDER],
+        frame.render_time);
+    lv_frame_histogram_record(
+        g_frame_histogram.histograms[LV_FRAME_HISTOGRAM_TYPE_FLUSH],
+        frame.flush_time);
+}
+
+static void lv_frame_histogram_display_event_callback(
+    lv_event_t* e)
+{
+    lv_frame_timing_t* timing =
+        static_cast<lv_frame_timing_t*>(lv_event_get_user_data(e));
+    lv_event_code_t code = lv_event_get_code(e);
+
+    if (LV_EVENT_DELETE == code)
+    {
+        delete timing;
+        return;
+    }
+
+    lv_frame_timing_frame_t frame;
+    if (lv_frame_timing_handle_event(timing, code, &frame))
+    {
+        lv_frame_histogram_frame_finished(frame);
+    }
+}
+
+#if LV_USE_SYSMON && LV_USE_PERF_MONITOR && LV_USE_PERF_MONITOR_LOG_MODE
+static void lv_frame_histogram_log_timer_callback(
+    lv_timer_t* timer)
+{
+    LV_UNUSED(timer);
+
+    lv_frame_histogram_snapshot_t snapshot;
+    if (!lv_frame_histogram_snapshot(&snapshot, true))
+    {
+        return;
+    }
+
+    if (!snapshot.stats[LV_FRAME_HISTOGRAM_TYPE_REFR].frame_count)
+    {
+        return;
+    }
+
+    static const char* const names[LV_FRAME_HISTOGRAM_TYPE_COUNT] =
+    {
+        "refr",
+        "render",
+        "flush"
+    };
+
+    for (size_t i = 0; i < LV_FRAME_HISTOGRAM_TYPE_COUNT; ++i)
+    {
+        const lv_frame_histogram_stats_t& stats = snapshot.stats[i];
+        LV_LOG_USER(
+            "%s: %u frames, avg %u us, p50 %u us, p95 %u us, p99 %u us, "
+            "max %u us",
+            names[i],
+            stats.frame_count,
+            stats.avg_time,
+            stats.p50_time,
+            stats.p95_time,
+            stats.p99_time,
+            stats.max_time);
+    }
+}
+#endif
+
+bool lv_frame_histogram_attach_display(
+    lv_display_t* display)
+{
+    if (!display)
+    {
+        return false;
+    }
+
+    lv_frame_timing_t* timing = new lv_frame_timing_t();
+
+    static const lv_event_code_t event_codes[] =
+    {
+        LV_EVENT_REFR_START,
+        LV_EVENT_RENDER_START,
+        LV_EVENT_FLUSH_START,
+        LV_EVENT_FLUSH_FINISH,
+        LV_EVENT_REFR_READY,
+        LV_EVENT_DELETE
+    };
+    for (lv_event_code_t event_code : event_codes)
+    {
+        lv_display_add_event_cb(
+            display,
+            lv_frame_histogram_display_event_callback,
+            event_code,
+            timing);
+    }
+
+#if LV_USE_SYSMON && LV_USE_PERF_MONITOR && LV_USE_PERF_MONITOR_LOG_MODE
+    static lv_timer_t* log_timer = NULL;
+    if (!log_timer)
+    {
+        log_timer = lv_timer_create(
+            lv_frame_histogram_log_timer_callback,
+            LV_FRAME_HISTOGRAM_LOG_PERIOD,
+            NULL);
+    }
+#endif
+
+    return true;
+}
+
+bool lv_frame_histogram_snapshot(
+    lv_frame_histogram_snapshot_t* snapshot,
+    bool reset)
+{
+    if (!snapshot)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(g_frame_histogram.mutex);
+
+    for (size_t i = 0; i < LV_FRAME_HISTOGRAM_TYPE_COUNT; ++i)
+    {
+        lv_frame_histogram_get_stats(
+            g_frame_histogram.histograms[i],
+            &snapshot->stats[i]);
+    }
+
+    if (reset)
+    {
+        std::memset(
+            g_frame_histogram.histograms,
+            0,
+            sizeof(g_frame_histogram.histograms));
+    }
+
+    return true;
+}
+
+void lv_frame_histogram_reset(void)
+{
+    std::lock_guard<std::mutex> lock(g_frame_histogram.mutex);
+    std::memset(
+        g_frame_histogram.histograms,
+        0,
+        sizeof(g_frame_histogram.histograms));
+}
+
+void lv_frame_histogram_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_frame_histogram_snapshot_t snapshot;
+    if (!buffer
+        || !buffer_size
+        || !lv_frame_histogram_snapshot(&snapshot, false))
+    {
+        return;
+    }
+
+    const lv_frame_histogram_stats_t& refr =
+        snapshot.stats[LV_FRAME_HISTOGRAM_TYPE_REFR];
+    const lv_frame_histogram_stats_t& render =
+        snapshot.stats[LV_FRAME_HISTOGRAM_TYPE_RENDER];
+    const lv_frame_histogram_stats_t& flush =
+        snapshot.stats[LV_FRAME_HISTOGRAM_TYPE_FLUSH];
+
+    // The times are shown in 0.1 ms, which is precise enough for the overlay.
+    std::snprintf(
+        buffer,
+        buffer_size,
+        "p50/p95/p99/max ms, refr %u.%u/%u.%u/%u.%u/%u.%u, "
+        "render %u.%u/%u.%u/%u.%u/%u.%u, flush %u.%u/%u.%u/%u.%u/%u.%u",
+        refr.p50_time / 1000, refr.p50_time / 100 % 10,
+        refr.p95_time / 1000, refr.p95_time / 100 % 10,
+        refr.p99_time / 1000, refr.p99_time / 100 % 10,
+        refr.max_time / 1000, refr.max_time / 100 % 10,
+        render.p50_time / 1000, render.p50_time / 100 % 10,
+        render.p95_time / 1000, render.p95_time / 100 % 10,
+        render.p99_time / 1000, render.p99_time / 100 % 10,
+        render.max_time / 1000, render.max_time / 100 % 10,
+        flush.p50_time / 1000, flush.p50_time / 100 % 10,
+        flush.p95_time / 1000, flush.p95_time / 100 % 10,
+        flush.p99_time / 1000, flush.p99_time / 100 % 10,
+        flush.max_time / 1000, flush.max_time / 100 % 10);
+}
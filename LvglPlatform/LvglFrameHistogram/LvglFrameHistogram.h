@@ -0,0 +1,111 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglFrameHistogram.h
+ * PURPOSE:   Definition for the frame time histograms of LVGL displays
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#ifndef LVGL_FRAME_HISTOGRAM_H
+#define LVGL_FRAME_HISTOGRAM_H
+
+#include "lvgl/lvgl.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The number of the linear sub-buckets of every power of 2 of the
+ *        histograms, which bounds the relative error of the percentiles to
+ *        1/16.
+ */
+#define LV_FRAME_HISTOGRAM_SUB_BUCKET_COUNT 16
+
+/**
+ * @brief The period in milliseconds of logging the percentiles when the
+ *        performance monitor of the sysmon is in the log mode.
+ */
+#ifndef LV_FRAME_HISTOGRAM_LOG_PERIOD
+#define LV_FRAME_HISTOGRAM_LOG_PERIOD 1000
+#endif
+
+typedef enum _lv_frame_histogram_type_t
+{
+    // From LV_EVENT_REFR_START to LV_EVENT_REFR_READY.
+    LV_FRAME_HISTOGRAM_TYPE_REFR,
+    // The refresh time without the flush time.
+    LV_FRAME_HISTOGRAM_TYPE_RENDER,
+    // From LV_EVENT_FLUSH_START to LV_EVENT_FLUSH_FINISH, summed per frame.
+    LV_FRAME_HISTOGRAM_TYPE_FLUSH,
+    LV_FRAME_HISTOGRAM_TYPE_COUNT
+} lv_frame_histogram_type_t;
+
+typedef struct _lv_frame_histogram_stats_t
+{
+    uint32_t frame_count;
+    // The times in microseconds.
+    uint32_t avg_time;
+    uint32_t p50_time;
+    uint32_t p95_time;
+    uint32_t p99_time;
+    uint32_t max_time;
+} lv_frame_histogram_stats_t;
+
+typedef struct _lv_frame_histogram_snapshot_t
+{
+    lv_frame_histogram_stats_t stats[LV_FRAME_HISTOGRAM_TYPE_COUNT];
+} lv_frame_histogram_snapshot_t;
+
+/**
+ * @brief Records the refresh, render and flush time of every rendered frame
+ *        of the display. The frames without anything to render are ignored.
+ * @param display The display.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark If LV_USE_PERF_MONITOR_LOG_MODE is enabled, the percentiles are
+ *         also logged every LV_FRAME_HISTOGRAM_LOG_PERIOD milliseconds, and
+ *         the histograms are reset after logging.
+ */
+bool lv_frame_histogram_attach_display(
+    lv_display_t* display);
+
+/**
+ * @brief Takes a snapshot of the percentiles of the histograms.
+ * @param snapshot The snapshot.
+ * @param reset Whether to reset the histograms after taking the snapshot, so
+ *              the next snapshot only covers the frames after this one.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark The percentiles are the upper bounds of their buckets, but never
+ *         larger than the maximum.
+ */
+bool lv_frame_histogram_snapshot(
+    lv_frame_histogram_snapshot_t* snapshot,
+    bool reset);
+
+/**
+ * @brief Resets the histograms.
+ */
+void lv_frame_histogram_reset(void);
+
+/**
+ * @brief Formats the p50, p95, p99 and maximum times of the histograms as a
+ *        single line of text, which can be used as the callback of
+ *        lv_stats_monitor_add_source.
+ * @param buffer The buffer which receives the formatted statistics.
+ * @param buffer_size The size of the buffer in bytes.
+ * @param user_data Unused.
+ */
+void lv_frame_histogram_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !LVGL_FRAME_HISTOGRAM_H */
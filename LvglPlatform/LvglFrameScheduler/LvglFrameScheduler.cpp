@@ -0,0 +1,551 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglFrameScheduler.cpp
+ * PURPOSE:   Implementation for the vsync aligned frame scheduler of LVGL
+ *            displays
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglFrameScheduler.h"
+
+#include "lvgl/src/lvgl_private.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// The period of the refresh timer of the attached displays, which is long
+// enough to never expire, so the refresh timer only runs when the scheduler
+// makes it ready. It is not UINT32_MAX because lv_timer_ready computes the
+// last run time by subtracting the period from the current tick.
+#define LV_FRAME_SCHEDULER_REFR_TIMER_PERIOD 0x7FFFFFFF
+
+typedef struct _lv_frame_scheduler_context_t
+{
+    lv_display_t* display;
+    lv_timer_t* pacing_timer;
+
+    // Written by the vsync source with the mutex of the scheduler held.
+    uint64_t vsync_time;
+    uint32_t period;
+    uint64_t vsync_count;
+
+    // Only accessed from the LVGL thread.
+    uint64_t anchor_time;
+    uint64_t last_refresh_vsync_time;
+    bool last_skipped;
+    bool rendered;
+    uint64_t refr_start_time;
+    uint32_t predicted_render_time;
+    uint32_t min_period;
+    uint32_t interval;
+    bool external_vsync;
+    uint64_t frame_count;
+    uint64_t skipped_count;
+
+    std::thread vsync_thread;
+    std::atomic<bool> vsync_thread_exit;
+} lv_frame_scheduler_context_t;
+
+static struct
+{
+    std::mutex mutex;
+    std::vector<lv_frame_scheduler_context_t*> contexts;
+    lv_frame_scheduler_clock_cb_t clock_cb;
+} g_frame_scheduler;
+
+static uint64_t lv_frame_scheduler_get_host_time()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+static uint64_t lv_frame_scheduler_get_time()
+{
+    return g_frame_scheduler.clock_cb
+        ? g_frame_scheduler.clock_cb()
+        : lv_frame_scheduler_get_host_time();
+}
+
+static uint32_t lv_frame_scheduler_get_host_period()
+{
+#ifdef _WIN32
+    DEVMODEW mode = {};
+    mode.dmSize = sizeof(DEVMODEW);
+    // 0 and 1 mean the default refresh rate of the hardware.
+    if (::EnumDisplaySettingsW(NULL, ENUM_CURRENT_SETTINGS, &mode)
+        && mode.dmDisplayFrequency > 1)
+    {
+        return 1000000 / mode.dmDisplayFrequency;
+    }
+#endif
+
+    return LV_DEF_REFR_PERIOD * 1000;
+}
+
+static lv_frame_scheduler_context_t* lv_frame_scheduler_find_context(
+    lv_display_t* display)
+{
+    for (lv_frame_scheduler_context_t* context : g_frame_scheduler.contexts)
+    {
+        if (display == context->display)
+        {
+            return context;
+        }
+    }
+
+    return NULL;
+}
+
+static void lv_frame_scheduler_record_vsync(
+    lv_frame_scheduler_context_t* context,
+    uint64_t time)
+{
+    if (context->vsync_time && time > context->vsync_time)
+    {
+        // Only the intervals close to the current period are measured, so
+        // the missed vsync signals don't disturb the measurement.
+        uint64_t interval = time - context->vsync_time;
+        if (interval * 2 > context->period && interval < context->period * 2)
+        {
+            context->period = static_cast<uint32_t>(
+                (context->period * 7ULL + interval) / 8);
+        }
+    }
+
+    context->vsync_time = time;
+    ++context->vsync_count;
+}
+
+static void lv_frame_scheduler_schedule(
+    lv_frame_scheduler_context_t* context,
+    uint64_t next_vsync_time,
+    uint64_t now)
+{
+    // Round up, so the timer never runs before the vsync.
+    uint64_t delay = next_vsync_time > now
+        ? (next_vsync_time - now + 999) / 1000
+        : 1;
+    lv_timer_set_period(
+        context->pacing_timer,
+        static_cast<uint32_t>(LV_CLAMP(1, delay, UINT32_MAX)));
+    lv_timer_reset(context->pacing_timer);
+}
+
+// Checks whether the next refresh of the display has anything to do, which
+// is rendering the invalidated areas or updating the layouts marked dirty.
+static bool lv_frame_scheduler_has_pending_update(
+    lv_display_t* display)
+{
+    if (display->inv_p)
+    {
+        return true;
+    }
+
+    lv_obj_t* screens[] =
+    {
+        display->act_scr,
+        display->prev_scr,
+        display->bottom_layer,
+        display->top_layer,
+        display->sys_layer
+    };
+    for (lv_obj_t* screen : screens)
+    {
+        if (screen && screen->scr_layout_inv)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void lv_frame_scheduler_pacing_timer_callback(
+    lv_timer_t* timer)
+{
+    lv_frame_scheduler_context_t* context =
+        static_cast<lv_frame_scheduler_context_t*>(
+            lv_timer_get_user_data(timer));
+
+    uint64_t now = lv_frame_scheduler_get_time();
+
+    uint64_t vsync_time = 0;
+    uint32_t period = 0;
+    {
+        std::lock_guard<std::mutex> lock(g_frame_scheduler.mutex);
+        vsync_time = context->vsync_time;
+        period = LV_MAX(context->period, 1U);
+    }
+
+    // Fall back to the own cadence if the vsync source stopped.
+    context->external_vsync = vsync_time
+        && now < vsync_time
+            + static_cast<uint64_t>(period) * LV_FRAME_SCHEDULER_VSYNC_TIMEOUT;
+    uint64_t base_time = context->external_vsync
+        ? vsync_time
+        : context->anchor_time;
+    base_time = LV_MIN(base_time, now);
+
+    // The latest vsync which is not later than now.
+    uint64_t current_vsync_time =
+        base_time + (now - base_time) / period * period;
+    uint64_t next_vsync_time = current_vsync_time + period;
+
+    context->interval = LV_MAX(
+        (LV_MAX(context->predicted_render_time, context->min_period)
+            + period - 1) / period,
+        1U);
+
+    // The number of vsyncs since the last refresh, rounded to the nearest,
+    // because the predicted vsyncs drift when the period is measured.
+    uint64_t elapsed_vsync_count = context->last_refresh_vsync_time
+        ? (current_vsync_time - LV_MIN(
+            context->last_refresh_vsync_time,
+            current_vsync_time) + period / 2) / period
+        : UINT64_MAX;
+    // Wait for the next vsync without refreshing if nothing is invalidated,
+    // so a static screen doesn't run the refresh timer on every vsync.
+    if (!lv_frame_scheduler_has_pending_update(context->display))
+    {
+        lv_frame_scheduler_schedule(context, next_vsync_time, now);
+        return;
+    }
+
+    if (elapsed_vsync_count < context->interval)
+    {
+        // Sleep until the first vsync which may start a refresh.
+        lv_frame_scheduler_schedule(
+            context,
+            next_vsync_time + static_cast<uint64_t>(period)
+                * (context->interval - elapsed_vsync_count - 1),
+            now);
+        return;
+    }
+
+    // Skip the vsync if the refresh would not be finished before the
+    // deadline, but never skip twice in a row, so a render time close to the
+    // vsync period can't stop the refreshes.
+    uint64_t deadline_time =
+        current_vsync_time + static_cast<uint64_t>(period) * context->interval;
+    if (!context->last_skipped
+        && now + context->predicted_render_time > deadline_time)
+    {
+        context->last_skipped = true;
+        ++context->skipped_count;
+        lv_frame_scheduler_schedule(context, next_vsync_time, now);
+        return;
+    }
+
+    context->last_skipped = false;
+    context->last_refresh_vsync_time = current_vsync_time;
+    ++context->frame_count;
+
+    lv_timer_t* refr_timer = lv_display_get_refr_timer(context->display);
+    if (refr_timer)
+    {
+        lv_timer_ready(refr_timer);
+    }
+
+    lv_frame_scheduler_schedule(context, next_vsync_time, now);
+}
+
+#ifdef _WIN32
+typedef HRESULT(WINAPI* lv_frame_scheduler_dwm_flush_t)();
+
+static void lv_frame_scheduler_host_vsync_thread(
+    lv_frame_scheduler_context_t* context,
+    lv_frame_scheduler_dwm_flush_t dwm_flush)
+{
+    while (!context->vsync_thread_exit.load(std::memory_order_acquire))
+    {
+        // DwmFlush returns after the next composition, and fails if the
+        // desktop composition is disabled.
+        if (FAILED(dwm_flush()))
+        {
+            ::Sleep(LV_DEF_REFR_PERIOD);
+            continue;
+        }
+
+        uint64_t time = lv_frame_scheduler_get_time();
+        std::lock_guard<std::mutex> lock(g_frame_scheduler.mutex);
+        lv_frame_scheduler_record_vsync(context, time);
+    }
+}
+#endif
+
+static void lv_frame_scheduler_stop_vsync_thread(
+    lv_frame_scheduler_context_t* context)
+{
+    if (context->vsync_thread.joinable())
+    {
+        context->vsync_thread_exit.store(true, std::memory_order_release);
+        context->vsync_thread.join();
+    }
+}
+
+static void lv_frame_scheduler_display_event_callback(
+    lv_event_t* e)
+{
+    lv_frame_scheduler_context_t* context =
+        static_cast<lv_frame_scheduler_context_t*>(lv_event_get_user_data(e));
+
+    switch (lv_event_get_code(e))
+    {
+    case LV_EVENT_REFR_START:
+        context->rendered = false;
+        context->refr_start_time = lv_frame_scheduler_get_time();
+        break;
+    case LV_EVENT_RENDER_START:
+        context->rendered = true;
+        break;
+    case LV_EVENT_REFR_READY:
+        if (context->rendered)
+        {
+            uint64_t render_time =
+                lv_frame_scheduler_get_time() - context->refr_start_time;
+            render_time = LV_MIN(render_time, UINT32_MAX);
+            context->predicted_render_time = context->predicted_render_time
+                ? static_cast<uint32_t>(
+                    (context->predicted_render_time * 7ULL + render_time) / 8)
+                : static_cast<uint32_t>(render_time);
+        }
+        break;
+    case LV_EVENT_DELETE:
+    {
+        lv_frame_scheduler_stop_vsync_thread(context);
+        lv_timer_delete(context->pacing_timer);
+        {
+            std::lock_guard<std::mutex> lock(g_frame_scheduler.mutex);
+            g_frame_scheduler.contexts.erase(std::remove(
+                g_frame_scheduler.contexts.begin(),
+                g_frame_scheduler.contexts.end(),
+                context), g_frame_scheduler.contexts.end());
+        }
+        delete context;
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void lv_frame_scheduler_set_clock_cb(
+    lv_frame_scheduler_clock_cb_t clock_cb)
+{
+    g_frame_scheduler.clock_cb = clock_cb;
+}
+
+bool lv_frame_scheduler_attach_display(
+    lv_display_t* display,
+    uint32_t period)
+{
+    if (!display)
+    {
+        return false;
+    }
+
+    lv_timer_t* refr_timer = lv_display_get_refr_timer(display);
+    if (!refr_timer)
+    {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(g_frame_scheduler.mutex);
+        if (lv_frame_scheduler_find_context(display))
+        {
+            return false;
+        }
+    }
+
+    lv_frame_scheduler_context_t* context = new lv_frame_scheduler_context_t();
+    context->display = display;
+    context->period = period ? period : lv_frame_scheduler_get_host_period();
+    context->anchor_time = lv_frame_scheduler_get_time();
+    context->interval = 1;
+    context->pacing_timer = lv_timer_create(
+        lv_frame_scheduler_pacing_timer_callback,
+        LV_MAX(context->period / 1000, 1U),
+        context);
+    if (!context->pacing_timer)
+    {
+        delete context;
+        return false;
+    }
+
+    lv_timer_set_period(refr_timer, LV_FRAME_SCHEDULER_REFR_TIMER_PERIOD);
+    lv_timer_reset(refr_timer);
+
+    static const lv_event_code_t event_codes[] =
+    {
+        LV_EVENT_REFR_START,
+        LV_EVENT_RENDER_START,
+        LV_EVENT_REFR_READY,
+        LV_EVENT_DELETE
+    };
+    for (lv_event_code_t event_code : event_codes)
+    {
+        lv_display_add_event_cb(
+            display,
+            lv_frame_scheduler_display_event_callback,
+            event_code,
+            context);
+    }
+
+    std::lock_guard<std::mutex> lock(g_frame_scheduler.mutex);
+    g_frame_scheduler.contexts.push_back(context);
+
+    return true;
+}
+
+bool lv_frame_scheduler_set_min_period(
+    lv_display_t* display,
+    uint32_t period)
+{
+    lv_frame_scheduler_context_t* context = NULL;
+    {
+        std::lock_guard<std::mutex> lock(g_frame_scheduler.mutex);
+        context = lv_frame_scheduler_find_context(display);
+    }
+    if (!context)
+    {
+        return false;
+    }
+
+    if (period < context->min_period)
+    {
+        lv_timer_ready(context->pacing_timer);
+    }
+    context->min_period = period;
+
+    return true;
+}
+
+void lv_frame_scheduler_signal_vsync(
+    lv_display_t* display,
+    uint64_t time)
+{
+    std::lock_guard<std::mutex> lock(g_frame_scheduler.mutex);
+
+    lv_frame_scheduler_context_t* context =
+        lv_frame_scheduler_find_context(display);
+    if (context)
+    {
+        lv_frame_scheduler_record_vsync(context, time);
+    }
+}
+
+bool lv_frame_scheduler_start_host_vsync(
+    lv_display_t* display)
+{
+#ifdef _WIN32
+    static lv_frame_scheduler_dwm_flush_t dwm_flush =
+        []() -> lv_frame_scheduler_dwm_flush_t
+    {
+        HMODULE module_handle = ::LoadLibraryW(L"dwmapi.dll");
+        if (!module_handle)
+        {
+            return NULL;
+        }
+        return reinterpret_cast<lv_frame_scheduler_dwm_flush_t>(
+            ::GetProcAddress(module_handle, "DwmFlush"));
+    }();
+    if (!dwm_flush)
+    {
+        return false;
+    }
+
+    lv_frame_scheduler_context_t* context = NULL;
+    {
+        std::lock_guard<std::mutex> lock(g_frame_scheduler.mutex);
+        context = lv_frame_scheduler_find_context(display);
+    }
+    if (!context || context->vsync_thread.joinable())
+    {
+        return false;
+    }
+
+    context->vsync_thread_exit.store(false, std::memory_order_release);
+    context->vsync_thread = std::thread(
+        lv_frame_scheduler_host_vsync_thread,
+        context,
+        dwm_flush);
+
+    return true;
+#else
+    LV_UNUSED(display);
+    return false;
+#endif
+}
+
+bool lv_frame_scheduler_get_stats(
+    lv_display_t* display,
+    lv_frame_scheduler_stats_t* stats)
+{
+    if (!stats)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(g_frame_scheduler.mutex);
+
+    lv_frame_scheduler_context_t* context =
+        lv_frame_scheduler_find_context(display);
+    if (!context)
+    {
+        return false;
+    }
+
+    stats->period = context->period;
+    stats->predicted_render_time = context->predicted_render_time;
+    stats->interval = context->interval;
+    stats->external_vsync = context->external_vsync;
+    stats->vsync_count = context->vsync_count;
+    stats->frame_count = context->frame_count;
+    stats->skipped_count = context->skipped_count;
+
+    return true;
+}
+
+void lv_frame_scheduler_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data)
+{
+    lv_frame_scheduler_stats_t stats;
+    if (!buffer
+        || !buffer_size
+        || !lv_frame_scheduler_get_stats(
+            static_cast<lv_display_t*>(user_data),
+            &stats))
+    {
+        return;
+    }
+
+    std::snprintf(
+        buffer,
+        buffer_size,
+        "%u.%u ms %s vsync, every %u vsyncs, render %u.%u ms, "
+        "%llu frames, %llu skipped",
+        stats.period / 1000,
+        stats.period / 100 % 10,
+        stats.external_vsync ? "host" : "own",
+        stats.interval,
+        stats.predicted_render_time / 1000,
+        stats.predicted_render_time / 100 % 10,
+        static_cast<unsigned long long>(stats.frame_count),
+        static_cast<unsigned long long>(stats.skipped_count));
+}
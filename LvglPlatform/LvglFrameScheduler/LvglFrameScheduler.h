@@ -0,0 +1,145 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglFrameScheduler.h
+ * PURPOSE:   Definition for the vsync aligned frame scheduler of LVGL displays
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#ifndef LVGL_FRAME_SCHEDULER_H
+#define LVGL_FRAME_SCHEDULER_H
+
+#include "lvgl/lvgl.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The number of vsync periods without a vsync signal after which the
+ *        scheduler falls back to its own cadence.
+ */
+#define LV_FRAME_SCHEDULER_VSYNC_TIMEOUT 4
+
+/**
+ * @brief The callback which returns the current time in microseconds of the
+ *        clock used by the scheduler.
+ */
+typedef uint64_t (*lv_frame_scheduler_clock_cb_t)(void);
+
+typedef struct _lv_frame_scheduler_stats_t
+{
+    // The vsync period in microseconds, measured from the vsync signals if
+    // there are any.
+    uint32_t period;
+    // The predicted render time in microseconds, which is the moving average
+    // of the recent refreshes.
+    uint32_t predicted_render_time;
+    // The number of vsync periods of every refresh, which is larger than 1
+    // when the predicted render time is longer than the vsync period or the
+    // minimum refresh period is set.
+    uint32_t interval;
+    bool external_vsync;
+    uint64_t vsync_count;
+    uint64_t frame_count;
+    // The vsyncs skipped because the refresh would miss the next deadline.
+    uint64_t skipped_count;
+} lv_frame_scheduler_stats_t;
+
+/**
+ * @brief Sets the clock used by the scheduler, e.g. a synthetic clock which
+ *        makes the scheduling deterministic.
+ * @param clock_cb The clock callback, or NULL for the monotonic clock of the
+ *                 host.
+ * @remark It must be called before attaching any display.
+ */
+void lv_frame_scheduler_set_clock_cb(
+    lv_frame_scheduler_clock_cb_t clock_cb);
+
+/**
+ * @brief Takes over the refresh timer of the display, and starts the refreshes
+ *        on the vsyncs instead of every LV_DEF_REFR_PERIOD.
+ * @param display The display.
+ * @param period The vsync period in microseconds when there is no vsync
+ *               signal. 0 means the refresh period of the monitor of the host,
+ *               or LV_DEF_REFR_PERIOD if it is unknown.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark The vsyncs are predicted from the last vsync signal and the measured
+ *         vsync period, and the refreshes are started by a LVGL timer, so the
+ *         refreshes are aligned to the vsyncs within 1 millisecond. The
+ *         vsyncs without any invalidated area or dirty layout don't start a
+ *         refresh.
+ */
+bool lv_frame_scheduler_attach_display(
+    lv_display_t* display,
+    uint32_t period);
+
+/**
+ * @brief Sets the minimum period between the refreshes of the display, which
+ *        is rounded up to whole vsync periods.
+ * @param display The display.
+ * @param period The minimum period in microseconds. 0 means refreshing on
+ *               every vsync.
+ * @return If succeed, return true. Otherwise, return false, e.g. the display
+ *         is not attached to the scheduler.
+ * @remark If the period is shortened, the next refresh is started on the
+ *         next vsync instead of waiting for the previous minimum period.
+ */
+bool lv_frame_scheduler_set_min_period(
+    lv_display_t* display,
+    uint32_t period);
+
+/**
+ * @brief Signals a vsync of the display from an external vsync source.
+ * @param display The display.
+ * @param time The time of the vsync from the clock of the scheduler.
+ * @remark It can be called from any thread, and can be used as the vsync
+ *         callback of lv_headless_set_vsync_cb.
+ */
+void lv_frame_scheduler_signal_vsync(
+    lv_display_t* display,
+    uint64_t time);
+
+/**
+ * @brief Starts a thread which signals the vsyncs of the compositor of the
+ *        host to the display.
+ * @param display The display.
+ * @return If succeed, return true. Otherwise, return false, e.g. there is no
+ *         such vsync source on the host.
+ * @remark It uses DwmFlush on Windows, and isn't supported on other hosts.
+ */
+bool lv_frame_scheduler_start_host_vsync(
+    lv_display_t* display);
+
+/**
+ * @brief Gets the statistics of the scheduler of the display.
+ * @param display The display.
+ * @param stats The statistics.
+ * @return If succeed, return true. Otherwise, return false.
+ */
+bool lv_frame_scheduler_get_stats(
+    lv_display_t* display,
+    lv_frame_scheduler_stats_t* stats);
+
+/**
+ * @brief Formats the statistics of the scheduler of a display as a single
+ *        line of text, which can be used as the callback of
+ *        lv_stats_monitor_add_source.
+ * @param buffer The buffer which receives the formatted statistics.
+ * @param buffer_size The size of the buffer in bytes.
+ * @param user_data The display.
+ */
+void lv_frame_scheduler_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !LVGL_FRAME_SCHEDULER_H */
@@ -0,0 +1,68 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglFrameTiming.cpp
+ * PURPOSE:   Implementation for the frame timing of LVGL displays
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglFrameTiming.h"
+
+#include <chrono>
+
+uint64_t lv_frame_timing_get_time(void)
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+bool lv_frame_timing_handle_event(
+    lv_frame_timing_t* timing,
+    lv_event_code_t code,
+    lv_frame_timing_frame_t* frame)
+{
+    if (!timing || !frame)
+    {
+        return false;
+    }
+
+    switch (code)
+    {
+    case LV_EVENT_REFR_START:
+        timing->rendered = false;
+        timing->flush_time = 0;
+        timing->refr_start_time = lv_frame_timing_get_time();
+        break;
+    case LV_EVENT_RENDER_START:
+        timing->rendered = true;
+        break;
+    case LV_EVENT_FLUSH_START:
+        timing->flush_start_time = lv_frame_timing_get_time();
+        break;
+    case LV_EVENT_FLUSH_FINISH:
+        timing->flush_time +=
+            lv_frame_timing_get_time() - timing->flush_start_time;
+        break;
+    case LV_EVENT_REFR_READY:
+    {
+        if (!timing->rendered)
+        {
+            return false;
+        }
+        timing->rendered = false;
+
+        frame->refr_time =
+            lv_frame_timing_get_time() - timing->refr_start_time;
+        frame->flush_time = LV_MIN(timing->flush_time, frame->refr_time);
+        frame->render_time = frame->refr_time - frame->flush_time;
+        return true;
+    }
+    default:
+        break;
+    }
+
+    return false;
+}
@@ -0,0 +1,66 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglFrameTiming.h
+ * PURPOSE:   Definition for the frame timing of LVGL displays
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#ifndef LVGL_FRAME_TIMING_H
+#define LVGL_FRAME_TIMING_H
+
+#include "lvgl/lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct _lv_frame_timing_t
+{
+    bool rendered;
+    uint64_t refr_start_time;
+    uint64_t flush_start_time;
+    uint64_t flush_time;
+} lv_frame_timing_t;
+
+typedef struct _lv_frame_timing_frame_t
+{
+    // The times in microseconds.
+    // From LV_EVENT_REFR_START to LV_EVENT_REFR_READY.
+    uint64_t refr_time;
+    // The refresh time without the flush time.
+    uint64_t render_time;
+    // From LV_EVENT_FLUSH_START to LV_EVENT_FLUSH_FINISH, summed per frame.
+    uint64_t flush_time;
+} lv_frame_timing_frame_t;
+
+/**
+ * @brief Gets the time of the steady clock used for the frame timing.
+ * @return The time in microseconds.
+ */
+uint64_t lv_frame_timing_get_time(void);
+
+/**
+ * @brief Tracks the refresh and flush events of a display, so the events from
+ *        LV_EVENT_REFR_START to LV_EVENT_REFR_READY are measured as a frame.
+ * @param timing The timing state of the display, which is zero initialized.
+ * @param code The code of the display event.
+ * @param frame The times of the frame, which are filled when returning true.
+ * @return Return true if the event is LV_EVENT_REFR_READY of a frame which
+ *         was rendered. Otherwise, return false.
+ * @remark The display events from LV_EVENT_REFR_START to LV_EVENT_REFR_READY
+ *         are needed, and the refreshes without any invalidated area are not
+ *         counted as frames.
+ */
+bool lv_frame_timing_handle_event(
+    lv_frame_timing_t* timing,
+    lv_event_code_t code,
+    lv_frame_timing_frame_t* frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !LVGL_FRAME_TIMING_H */
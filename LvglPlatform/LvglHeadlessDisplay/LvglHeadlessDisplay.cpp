@@ -0,0 +1,324 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglHeadlessDisplay.cpp
+ * PURPOSE:   Implementation for the headless display backend for LVGL
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglHeadlessDisplay.h"
+
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <new>
+#include <thread>
+#include <vector>
+
+typedef struct _lv_headless_display_context_t
+{
+    lv_display_t* display;
+    lv_draw_buf_t* framebuffer;
+    // Also incremented by the presenter thread of the buffering layer.
+    std::atomic<uint32_t> frame_count;
+
+    // Only accessed from the LVGL thread.
+    uint32_t render_cost;
+    lv_headless_vsync_cb_t vsync_cb;
+    uint32_t vsync_period;
+    uint64_t next_vsync_time;
+} lv_headless_display_context_t;
+
+// The synthetic clock in microseconds, so the render costs shorter than a
+// tick can be added to it.
+static std::atomic<uint64_t> g_synthetic_time(0);
+static std::atomic<bool> g_synthetic_clock_enabled(false);
+// The displays which signal the vsyncs of the synthetic clock, which are only
+// accessed from the LVGL thread.
+static std::vector<lv_headless_display_context_t*> g_vsync_contexts;
+
+static uint64_t lv_headless_get_host_time()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+static uint32_t lv_headless_tick_count_callback()
+{
+    return static_cast<uint32_t>(lv_headless_get_host_time() / 1000);
+}
+
+static void lv_headless_delay_callback(
+    uint32_t ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+static void lv_headless_advance_synthetic_clock(
+    uint64_t time)
+{
+    uint64_t now =
+        g_synthetic_time.fetch_add(time, std::memory_order_acq_rel) + time;
+
+    for (lv_headless_display_context_t* context : g_vsync_contexts)
+    {
+        if (now < context->next_vsync_time)
+        {
+            continue;
+        }
+
+        // Only the latest vsync is signaled if several are passed at once,
+        // like a compositor which is late.
+        uint64_t vsync_time = context->next_vsync_time
+            + (now - context->next_vsync_time)
+            / context->vsync_period * context->vsync_period;
+        context->next_vsync_time = vsync_time + context->vsync_period;
+        context->vsync_cb(context->display, vsync_time);
+    }
+}
+
+static uint32_t lv_headless_synthetic_tick_count_callback()
+{
+    return static_cast<uint32_t>(
+        g_synthetic_time.load(std::memory_order_acquire) / 1000);
+}
+
+static void lv_headless_synthetic_delay_callback(
+    uint32_t ms)
+{
+    lv_headless_advance_synthetic_clock(ms * 1000ULL);
+}
+
+static void lv_headless_display_flush_callback(
+    lv_display_t* display,
+    const lv_area_t* area,
+    uint8_t* px_map)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+
+    lv_headless_display_context_t* context =
+        static_cast<lv_headless_display_context_t*>(
+            lv_display_get_driver_data(display));
+    if (context && lv_display_flush_is_last(display))
+    {
+        ++context->frame_count;
+    }
+
+    // The framebuffer is rendered in place in the direct render mode, so
+    // there is nothing to present.
+    lv_display_flush_ready(display);
+}
+
+static void lv_headless_display_render_start_event_callback(
+    lv_event_t* e)
+{
+    lv_headless_display_context_t* context =
+        static_cast<lv_headless_display_context_t*>(
+            lv_event_get_user_data(e));
+    if (!context->render_cost)
+    {
+        return;
+    }
+
+    if (g_synthetic_clock_enabled.load(std::memory_order_acquire))
+    {
+        lv_headless_advance_synthetic_clock(context->render_cost);
+    }
+    else
+    {
+        std::this_thread::sleep_for(
+            std::chrono::microseconds(context->render_cost));
+    }
+}
+
+static void lv_headless_display_delete_event_callback(
+    lv_event_t* e)
+{
+    lv_headless_display_context_t* context =
+        static_cast<lv_headless_display_context_t*>(
+            lv_event_get_user_data(e));
+    if (!context)
+    {
+        return;
+    }
+
+    g_vsync_contexts.erase(
+        std::remove(g_vsync_contexts.begin(), g_vsync_contexts.end(), context),
+        g_vsync_contexts.end());
+
+    if (context->framebuffer)
+    {
+        lv_draw_buf_destroy(context->framebuffer);
+        context->framebuffer = NULL;
+    }
+
+    delete context;
+}
+
+lv_display_t* lv_headless_create_display(
+    int32_t hor_res,
+    int32_t ver_res)
+{
+    lv_tick_set_cb(lv_headless_tick_count_callback);
+    lv_delay_set_cb(lv_headless_delay_callback);
+
+    lv_display_t* display = lv_display_create(hor_res, ver_res);
+    if (!display)
+    {
+        return NULL;
+    }
+
+    // The context is constructed by new because of the atomic member.
+    lv_headless_display_context_t* context =
+        new (std::nothrow) lv_headless_display_context_t();
+    if (!context)
+    {
+        lv_display_delete(display);
+        return NULL;
+    }
+
+    context->display = display;
+    context->framebuffer = lv_draw_buf_create(
+        static_cast<uint32_t>(hor_res),
+        static_cast<uint32_t>(ver_res),
+        lv_display_get_color_format(display),
+        LV_STRIDE_AUTO);
+    if (!context->framebuffer)
+    {
+        delete context;
+        lv_display_delete(display);
+        return NULL;
+    }
+
+    lv_display_set_driver_data(display, context);
+    lv_display_add_event_cb(
+        display,
+        lv_headless_display_delete_event_callback,
+        LV_EVENT_DELETE,
+        context);
+    lv_display_add_event_cb(
+        display,
+        lv_headless_display_render_start_event_callback,
+        LV_EVENT_RENDER_START,
+        context);
+
+    lv_display_set_flush_cb(display, lv_headless_display_flush_callback);
+    lv_display_set_draw_buffers(display, context->framebuffer, NULL);
+    lv_display_set_render_mode(display, LV_DISPLAY_RENDER_MODE_DIRECT);
+
+    return display;
+}
+
+lv_draw_buf_t* lv_headless_get_framebuffer(
+    lv_display_t* display)
+{
+    lv_headless_display_context_t* context =
+        static_cast<lv_headless_display_context_t*>(
+            lv_display_get_driver_data(display));
+    return context ? context->framebuffer : NULL;
+}
+
+uint32_t lv_headless_get_frame_count(
+    lv_display_t* display)
+{
+    lv_headless_display_context_t* context =
+        static_cast<lv_headless_display_context_t*>(
+            lv_display_get_driver_data(display));
+    return context ? context->frame_count.load() : 0;
+}
+
+void lv_headless_present_frame(
+    lv_display_t* display,
+    const lv_area_t* area,
+    void* user_data)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(user_data);
+
+    lv_headless_display_context_t* context =
+        static_cast<lv_headless_display_context_t*>(
+            lv_display_get_driver_data(display));
+    if (context)
+    {
+        ++context->frame_count;
+    }
+}
+
+void lv_headless_set_synthetic_clock(
+    bool enabled)
+{
+    if (enabled)
+    {
+        g_synthetic_time.store(
+            lv_headless_get_host_time(),
+            std::memory_order_release);
+        lv_tick_set_cb(lv_headless_synthetic_tick_count_callback);
+        lv_delay_set_cb(lv_headless_synthetic_delay_callback);
+    }
+    else
+    {
+        lv_tick_set_cb(lv_headless_tick_count_callback);
+        lv_delay_set_cb(lv_headless_delay_callback);
+    }
+
+    g_synthetic_clock_enabled.store(enabled, std::memory_order_release);
+}
+
+uint64_t lv_headless_get_time(void)
+{
+    if (g_synthetic_clock_enabled.load(std::memory_order_acquire))
+    {
+        return g_synthetic_time.load(std::memory_order_acquire);
+    }
+
+    return lv_headless_get_host_time();
+}
+
+bool lv_headless_set_vsync_cb(
+    lv_display_t* display,
+    uint32_t period,
+    lv_headless_vsync_cb_t vsync_cb)
+{
+    lv_headless_display_context_t* context =
+        static_cast<lv_headless_display_context_t*>(
+            lv_display_get_driver_data(display));
+    if (!context || (vsync_cb && !period))
+    {
+        return false;
+    }
+
+    g_vsync_contexts.erase(
+        std::remove(g_vsync_contexts.begin(), g_vsync_contexts.end(), context),
+        g_vsync_contexts.end());
+
+    context->vsync_cb = vsync_cb;
+    context->vsync_period = period;
+    context->next_vsync_time = lv_headless_get_time() + period;
+    if (vsync_cb)
+    {
+        g_vsync_contexts.push_back(context);
+    }
+
+    return true;
+}
+
+bool lv_headless_set_render_cost(
+    lv_display_t* display,
+    uint32_t cost)
+{
+    lv_headless_display_context_t* context =
+        static_cast<lv_headless_display_context_t*>(
+            lv_display_get_driver_data(display));
+    if (!context)
+    {
+        return false;
+    }
+
+    context->render_cost = cost;
+
+    return true;
+}
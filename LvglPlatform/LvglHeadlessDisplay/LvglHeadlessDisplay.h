@@ -0,0 +1,129 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglHeadlessDisplay.h
+ * PURPOSE:   Definition for the headless display backend for LVGL
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#ifndef LVGL_HEADLESS_DISPLAY_H
+#define LVGL_HEADLESS_DISPLAY_H
+
+#include "lvgl/lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The callback which receives the vsyncs of a headless display.
+ * @param display The headless display object.
+ * @param time The time of the vsync in microseconds, from the clock returned
+ *             by lv_headless_get_time.
+ */
+typedef void (*lv_headless_vsync_cb_t)(
+    lv_display_t* display,
+    uint64_t time);
+
+/**
+ * @brief Creates a LVGL display which renders into an in-memory framebuffer
+ *        without any window or display server.
+ * @param hor_res The horizontal resolution of the display.
+ * @param ver_res The vertical resolution of the display.
+ * @return The created LVGL display object, or NULL if failed.
+ * @remark The tick and delay callbacks of LVGL will also be set to the
+ *         monotonic clock of the host, so you needn't call lv_tick_inc.
+ */
+lv_display_t* lv_headless_create_display(
+    int32_t hor_res,
+    int32_t ver_res);
+
+/**
+ * @brief Gets the framebuffer of a headless display.
+ * @param display The headless display object.
+ * @return The framebuffer of the display, or NULL if failed.
+ */
+lv_draw_buf_t* lv_headless_get_framebuffer(
+    lv_display_t* display);
+
+/**
+ * @brief Gets the number of frames flushed by a headless display.
+ * @param display The headless display object.
+ * @return The number of frames flushed since the display was created.
+ */
+uint32_t lv_headless_get_frame_count(
+    lv_display_t* display);
+
+/**
+ * @brief Counts a frame presented from another thread, which can be used as
+ *        the present callback of the display buffering layer, because the
+ *        buffering layer replaces the flush callback of the display.
+ * @param display The headless display object.
+ * @param area The bounding box of the areas of the frame.
+ * @param user_data Unused.
+ */
+void lv_headless_present_frame(
+    lv_display_t* display,
+    const lv_area_t* area,
+    void* user_data);
+
+/**
+ * @brief Switches the LVGL tick between the monotonic clock of the host and a
+ *        synthetic clock.
+ * @param enabled If true, the LVGL tick will be driven by a synthetic clock
+ *                which only advances when lv_delay_ms is called, so the main
+ *                loop runs as fast as possible and the timers, animations and
+ *                refreshes happen deterministically regardless of the
+ *                rendering speed.
+ */
+void lv_headless_set_synthetic_clock(
+    bool enabled);
+
+/**
+ * @brief Gets the current time in microseconds of the clock which drives the
+ *        LVGL tick, which is the synthetic clock if it is enabled.
+ * @return The current time in microseconds.
+ * @remark It can be used as the clock of the frame scheduler, so the vsyncs
+ *         follow the synthetic clock as well.
+ */
+uint64_t lv_headless_get_time(void);
+
+/**
+ * @brief Signals the vsyncs of a headless display at a fixed period of the
+ *        synthetic clock, e.g. to lv_frame_scheduler_signal_vsync.
+ * @param display The headless display object.
+ * @param period The vsync period in microseconds.
+ * @param vsync_cb The vsync callback, or NULL to stop signaling the vsyncs.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark The vsyncs are signaled from lv_delay_ms on the LVGL thread when the
+ *         synthetic clock advances, so there is no vsync while the synthetic
+ *         clock is disabled. If several vsyncs are passed at once, only the
+ *         latest one is signaled.
+ */
+bool lv_headless_set_vsync_cb(
+    lv_display_t* display,
+    uint32_t period,
+    lv_headless_vsync_cb_t vsync_cb);
+
+/**
+ * @brief Adds a fixed cost to the rendering of every frame of a headless
+ *        display, so the render time can be controlled, e.g. to test the frame
+ *        skipping of the frame scheduler.
+ * @param display The headless display object.
+ * @param cost The cost in microseconds. 0 means no extra cost.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark The cost advances the synthetic clock when it is enabled, which
+ *         otherwise measures the rendering as instant, or is slept on the
+ *         LVGL thread.
+ */
+bool lv_headless_set_render_cost(
+    lv_display_t* display,
+    uint32_t cost);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !LVGL_HEADLESS_DISPLAY_H */
@@ -0,0 +1,617 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglParallelDraw.cpp
+ * PURPOSE:   Implementation for the work-stealing parallel software draw unit
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglParallelDraw.h"
+#include "LvglCircleCache.h"
+#include "LvglProfilerTrace.h"
+#include "LvglSlabAllocator.h"
+
+#include "lvgl/src/lvgl_private.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+typedef struct _lv_parallel_draw_split_t
+{
+    std::atomic<uint32_t> remaining_tile_count;
+    // Whether the split is allocated from the frame arena, which is released
+    // as a whole at the end of the frame.
+    bool frame_allocated;
+} lv_parallel_draw_split_t;
+
+typedef struct _lv_parallel_draw_item_t
+{
+    lv_draw_task_t* task;
+    // Only used by the tiles of a split task, otherwise NULL.
+    lv_parallel_draw_split_t* split;
+    lv_area_t clip_area;
+} lv_parallel_draw_item_t;
+
+typedef struct _lv_parallel_draw_worker_t
+{
+    std::mutex mutex;
+    std::deque<lv_parallel_draw_item_t> items;
+    std::thread thread;
+} lv_parallel_draw_worker_t;
+
+typedef struct _lv_parallel_draw_context_t
+{
+    std::vector<std::unique_ptr<lv_parallel_draw_worker_t>> workers;
+    std::mutex sleep_mutex;
+    std::condition_variable sleep_condition;
+    bool exiting = false;
+    std::atomic<uint32_t> pending_count{ 0 };
+    uint32_t next_worker = 0;
+    int32_t tile_width = LV_PARALLEL_DRAW_TILE_WIDTH;
+    int32_t tile_height = LV_PARALLEL_DRAW_TILE_HEIGHT;
+    std::atomic<uint64_t> dispatched_task_count{ 0 };
+    std::atomic<uint64_t> executed_task_count{ 0 };
+    std::atomic<uint64_t> stolen_task_count{ 0 };
+    uint64_t split_task_count = 0;
+    uint64_t tile_count = 0;
+} lv_parallel_draw_context_t;
+
+typedef struct _lv_parallel_draw_unit_t
+{
+    lv_draw_unit_t base_unit;
+    lv_parallel_draw_context_t* context;
+} lv_parallel_draw_unit_t;
+
+static lv_parallel_draw_unit_t* g_parallel_draw_unit = NULL;
+
+static void lv_parallel_draw_execute(
+    lv_draw_task_t* t)
+{
+    switch (t->type)
+    {
+    case LV_DRAW_TASK_TYPE_FILL:
+        if (!lv_circle_cache_draw_fill(
+            t,
+            static_cast<const lv_draw_fill_dsc_t*>(t->draw_dsc),
+            &t->area))
+        {
+            lv_draw_sw_fill(
+                t,
+                static_cast<const lv_draw_fill_dsc_t*>(t->draw_dsc),
+                &t->area);
+        }
+        break;
+    case LV_DRAW_TASK_TYPE_BORDER:
+        lv_draw_sw_border(
+            t,
+            static_cast<const lv_draw_border_dsc_t*>(t->draw_dsc),
+            &t->area);
+        break;
+    case LV_DRAW_TASK_TYPE_LETTER:
+        lv_draw_sw_letter(
+            t,
+            static_cast<const lv_draw_letter_dsc_t*>(t->draw_dsc),
+            &t->area);
+        break;
+    case LV_DRAW_TASK_TYPE_LABEL:
+        lv_draw_sw_label(
+            t,
+            static_cast<const lv_draw_label_dsc_t*>(t->draw_dsc),
+            &t->area);
+        break;
+    case LV_DRAW_TASK_TYPE_IMAGE:
+        lv_draw_sw_image(
+            t,
+            static_cast<const lv_draw_image_dsc_t*>(t->draw_dsc),
+            &t->area);
+        break;
+    case LV_DRAW_TASK_TYPE_LAYER:
+        lv_draw_sw_layer(
+            t,
+            static_cast<const lv_draw_image_dsc_t*>(t->draw_dsc),
+            &t->area);
+        break;
+    case LV_DRAW_TASK_TYPE_ARC:
+        lv_draw_sw_arc(
+            t,
+            static_cast<const lv_draw_arc_dsc_t*>(t->draw_dsc),
+            &t->area);
+        break;
+    case LV_DRAW_TASK_TYPE_LINE:
+        lv_draw_sw_line(
+            t,
+            static_cast<const lv_draw_line_dsc_t*>(t->draw_dsc));
+        break;
+    case LV_DRAW_TASK_TYPE_TRIANGLE:
+        lv_draw_sw_triangle(
+            t,
+            static_cast<const lv_draw_triangle_dsc_t*>(t->draw_dsc));
+        break;
+    default:
+        break;
+    }
+}
+
+static bool lv_parallel_draw_pop_item(
+    lv_parallel_draw_context_t* context,
+    size_t index,
+    lv_parallel_draw_item_t* item)
+{
+    size_t worker_count = context->workers.size();
+
+    // Take the newest task from the own deque first, which is still hot in
+    // the cache of the current processor.
+    {
+        lv_parallel_draw_worker_t* worker = context->workers[index].get();
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        if (!worker->items.empty())
+        {
+            *item = worker->items.back();
+            worker->items.pop_back();
+            return true;
+        }
+    }
+
+    // Steal the oldest task from the other workers.
+    for (size_t i = 1; i < worker_count; ++i)
+    {
+        lv_parallel_draw_worker_t* victim =
+            context->workers[(index + i) % worker_count].get();
+        std::lock_guard<std::mutex> lock(victim->mutex);
+        if (!victim->items.empty())
+        {
+            *item = victim->items.front();
+            victim->items.pop_front();
+            context->stolen_task_count.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void lv_parallel_draw_worker_thread(
+    lv_parallel_draw_context_t* context,
+    size_t index)
+{
+    char thread_name[32];
+    std::snprintf(thread_name, sizeof(thread_name), "Draw worker %zu", index);
+    lv_profiler_trace_set_thread_name(thread_name);
+
+    for (;;)
+    {
+        lv_parallel_draw_item_t item;
+        if (lv_parallel_draw_pop_item(context, index, &item))
+        {
+            context->pending_count.fetch_sub(1, std::memory_order_acq_rel);
+
+            lv_draw_task_t* t = item.task;
+
+            if (item.split)
+            {
+                // Render a shallow copy of the task restricted to the tile,
+                // and the task is finished after the last tile is rendered.
+                lv_draw_task_t tile = *t;
+                tile.clip_area = item.clip_area;
+                lv_parallel_draw_execute(&tile);
+
+                if (1 != item.split->remaining_tile_count.fetch_sub(
+                    1,
+                    std::memory_order_acq_rel))
+                {
+                    continue;
+                }
+
+                if (item.split->frame_allocated)
+                {
+                    item.split->~lv_parallel_draw_split_t();
+                }
+                else
+                {
+                    delete item.split;
+                }
+            }
+            else
+            {
+                lv_parallel_draw_execute(t);
+            }
+
+            context->executed_task_count.fetch_add(
+                1,
+                std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_release);
+            t->state = LV_DRAW_TASK_STATE_FINISHED;
+
+            // Let LVGL dispatch the tasks which depend on the finished one.
+            lv_draw_dispatch_request();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(context->sleep_mutex);
+        context->sleep_condition.wait(lock, [context]()
+        {
+            return context->exiting ||
+                context->pending_count.load(std::memory_order_acquire);
+        });
+        if (context->exiting)
+        {
+            break;
+        }
+    }
+}
+
+static bool lv_parallel_draw_is_splittable(
+    lv_draw_task_t* t)
+{
+    switch (t->type)
+    {
+    case LV_DRAW_TASK_TYPE_FILL:
+    case LV_DRAW_TASK_TYPE_BORDER:
+    case LV_DRAW_TASK_TYPE_LAYER:
+        return true;
+    case LV_DRAW_TASK_TYPE_IMAGE:
+    {
+        // The images from files or other sources are decoded by every tile
+        // when the image cache is disabled, which costs more than it saves.
+        const lv_draw_image_dsc_t* draw_dsc =
+            static_cast<const lv_draw_image_dsc_t*>(t->draw_dsc);
+        return LV_IMAGE_SRC_VARIABLE == lv_image_src_get_type(draw_dsc->src);
+    }
+    default:
+        return false;
+    }
+}
+
+static uint32_t lv_parallel_draw_get_tile_count(
+    lv_parallel_draw_context_t* context,
+    lv_draw_task_t* t,
+    lv_area_t* draw_area)
+{
+    if (context->workers.size() < 2 ||
+        context->tile_height <= 0 ||
+        !lv_parallel_draw_is_splittable(t) ||
+        !lv_area_intersect(draw_area, &t->_real_area, &t->clip_area))
+    {
+        return 1;
+    }
+
+    int32_t tile_width = context->tile_width > 0
+        ? context->tile_width
+        : lv_area_get_width(draw_area);
+    int32_t tile_height = context->tile_height;
+
+    uint32_t columns = static_cast<uint32_t>(
+        (lv_area_get_width(draw_area) + tile_width - 1) / tile_width);
+    uint32_t rows = static_cast<uint32_t>(
+        (lv_area_get_height(draw_area) + tile_height - 1) / tile_height);
+    return columns * rows;
+}
+
+static void lv_parallel_draw_push_item(
+    lv_parallel_draw_context_t* context,
+    const lv_parallel_draw_item_t& item)
+{
+    lv_parallel_draw_worker_t* worker =
+        context->workers[context->next_worker].get();
+    context->next_worker =
+        (context->next_worker + 1) % context->workers.size();
+    {
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        worker->items.push_back(item);
+    }
+    context->pending_count.fetch_add(1, std::memory_order_acq_rel);
+}
+
+static void lv_parallel_draw_push_task(
+    lv_parallel_draw_context_t* context,
+    lv_draw_task_t* t)
+{
+    lv_parallel_draw_item_t item;
+    item.task = t;
+    item.split = NULL;
+    item.clip_area = t->clip_area;
+
+    lv_area_t draw_area;
+    uint32_t tile_count =
+        lv_parallel_draw_get_tile_count(context, t, &draw_area);
+    if (tile_count < 2)
+    {
+        lv_parallel_draw_push_item(context, item);
+        return;
+    }
+
+    int32_t tile_width = context->tile_width > 0
+        ? context->tile_width
+        : lv_area_get_width(&draw_area);
+    int32_t tile_height = context->tile_height;
+
+    void* split_block = lv_slab_allocator_frame_alloc(
+        sizeof(lv_parallel_draw_split_t));
+    item.split = split_block
+        ? new (split_block) lv_parallel_draw_split_t()
+        : new lv_parallel_draw_split_t();
+    item.split->frame_allocated = NULL != split_block;
+    item.split->remaining_tile_count.store(
+        tile_count,
+        std::memory_order_relaxed);
+
+    for (int32_t y = draw_area.y1; y <= draw_area.y2; y += tile_height)
+    {
+        for (int32_t x = draw_area.x1; x <= draw_area.x2; x += tile_width)
+        {
+            item.clip_area.x1 = x;
+            item.clip_area.y1 = y;
+            item.clip_area.x2 = LV_MIN(x + tile_width - 1, draw_area.x2);
+            item.clip_area.y2 = LV_MIN(y + tile_height - 1, draw_area.y2);
+            lv_parallel_draw_push_item(context, item);
+        }
+    }
+
+    ++context->split_task_count;
+    context->tile_count += tile_count;
+}
+
+static int32_t lv_parallel_draw_dispatch_callback(
+    lv_draw_unit_t* draw_unit,
+    lv_layer_t* layer)
+{
+    lv_parallel_draw_context_t* context =
+        reinterpret_cast<lv_parallel_draw_unit_t*>(draw_unit)->context;
+
+    int32_t dispatched_count = 0;
+
+    // Queue all independent tasks at once instead of only one task per
+    // worker, so the idle workers always have something to steal.
+    lv_draw_task_t* t = lv_draw_get_next_available_task(
+        layer,
+        NULL,
+        LV_PARALLEL_DRAW_UNIT_ID);
+    while (t)
+    {
+        if (!lv_draw_layer_alloc_buf(layer))
+        {
+            break;
+        }
+
+        t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+        t->draw_unit = draw_unit;
+
+        lv_parallel_draw_push_task(context, t);
+        ++dispatched_count;
+
+        t = lv_draw_get_next_available_task(
+            layer,
+            t,
+            LV_PARALLEL_DRAW_UNIT_ID);
+    }
+
+    if (!dispatched_count)
+    {
+        return LV_DRAW_UNIT_IDLE;
+    }
+
+    context->dispatched_task_count.fetch_add(
+        dispatched_count,
+        std::memory_order_relaxed);
+
+    {
+        std::lock_guard<std::mutex> lock(context->sleep_mutex);
+    }
+    context->sleep_condition.notify_all();
+
+    return dispatched_count;
+}
+
+static bool lv_parallel_draw_is_preferred(
+    lv_parallel_draw_context_t* context,
+    lv_draw_task_t* task)
+{
+    // The software draw units of LVGL are still running next to this unit,
+    // so only the rounded fills and the tasks covering more than one tile are
+    // claimed, and everything else is left to them. The box shadows are not
+    // claimed, because the blur of a shadow needs the whole shadow area and
+    // can't be rendered tile by tile, and LvglShadowCache already serves the
+    // software draw units.
+    if (LV_DRAW_TASK_TYPE_FILL == task->type &&
+        static_cast<const lv_draw_fill_dsc_t*>(task->draw_dsc)->radius)
+    {
+        // The corner masks are reused from LvglCircleCache instead of being
+        // computed again by every software draw unit.
+        return true;
+    }
+
+    // A software draw unit renders a large task alone, while this unit splits
+    // it into tiles rendered by all workers.
+    lv_area_t draw_area;
+    return lv_parallel_draw_get_tile_count(context, task, &draw_area) >= 2;
+}
+
+static int32_t lv_parallel_draw_evaluate_callback(
+    lv_draw_unit_t* draw_unit,
+    lv_draw_task_t* task)
+{
+    lv_parallel_draw_context_t* context =
+        reinterpret_cast<lv_parallel_draw_unit_t*>(draw_unit)->context;
+    if (!context)
+    {
+        return 0;
+    }
+
+    switch (task->type)
+    {
+    case LV_DRAW_TASK_TYPE_FILL:
+    case LV_DRAW_TASK_TYPE_BORDER:
+    case LV_DRAW_TASK_TYPE_LETTER:
+    case LV_DRAW_TASK_TYPE_LABEL:
+    case LV_DRAW_TASK_TYPE_ARC:
+    case LV_DRAW_TASK_TYPE_LINE:
+    case LV_DRAW_TASK_TYPE_TRIANGLE:
+        break;
+    case LV_DRAW_TASK_TYPE_IMAGE:
+    case LV_DRAW_TASK_TYPE_LAYER:
+    {
+        // Leave the images which the software renderer rejects to the other
+        // draw units, which is the same as the evaluation of lv_draw_sw.
+        const lv_draw_image_dsc_t* draw_dsc =
+            static_cast<const lv_draw_image_dsc_t*>(task->draw_dsc);
+        if (draw_dsc->skew_x != 0 || draw_dsc->skew_y != 0)
+        {
+            return 0;
+        }
+
+        lv_color_format_t cf = draw_dsc->header.cf;
+        if (draw_dsc->bitmap_mask_src &&
+            (cf == LV_COLOR_FORMAT_A8 || cf == LV_COLOR_FORMAT_RGB565A8))
+        {
+            return 0;
+        }
+
+        if (cf >= LV_COLOR_FORMAT_PROPRIETARY_START)
+        {
+            return 0;
+        }
+        break;
+    }
+    default:
+        return 0;
+    }
+
+    if (!lv_parallel_draw_is_preferred(context, task))
+    {
+        return 0;
+    }
+
+    // Slightly preferred over the built-in software draw units, but any
+    // hardware accelerated draw unit still wins.
+    if (task->preference_score >= 100)
+    {
+        task->preference_score = 99;
+        task->preferred_draw_unit_id = LV_PARALLEL_DRAW_UNIT_ID;
+    }
+
+    return 0;
+}
+
+static int32_t lv_parallel_draw_delete_callback(
+    lv_draw_unit_t* draw_unit)
+{
+    lv_parallel_draw_unit_t* unit =
+        reinterpret_cast<lv_parallel_draw_unit_t*>(draw_unit);
+    lv_parallel_draw_context_t* context = unit->context;
+    if (!context)
+    {
+        return 0;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(context->sleep_mutex);
+        context->exiting = true;
+    }
+    context->sleep_condition.notify_all();
+
+    for (auto& worker : context->workers)
+    {
+        if (worker->thread.joinable())
+        {
+            worker->thread.join();
+        }
+    }
+
+    delete context;
+    unit->context = NULL;
+
+    if (g_parallel_draw_unit == unit)
+    {
+        g_parallel_draw_unit = NULL;
+    }
+
+    return 0;
+}
+
+bool lv_parallel_draw_init(
+    uint32_t worker_count)
+{
+    if (g_parallel_draw_unit)
+    {
+        return false;
+    }
+
+    if (!worker_count)
+    {
+        worker_count = std::thread::hardware_concurrency();
+    }
+    worker_count = LV_CLAMP(1U, worker_count, LV_PARALLEL_DRAW_MAX_WORKERS);
+
+    lv_parallel_draw_context_t* context = new lv_parallel_draw_context_t();
+    for (uint32_t i = 0; i < worker_count; ++i)
+    {
+        context->workers.emplace_back(new lv_parallel_draw_worker_t());
+    }
+    for (uint32_t i = 0; i < worker_count; ++i)
+    {
+        context->workers[i]->thread = std::thread(
+            lv_parallel_draw_worker_thread,
+            context,
+            static_cast<size_t>(i));
+    }
+
+    lv_parallel_draw_unit_t* unit = static_cast<lv_parallel_draw_unit_t*>(
+        lv_draw_create_unit(sizeof(lv_parallel_draw_unit_t)));
+    unit->base_unit.name = "PARALLEL";
+    unit->base_unit.dispatch_cb = lv_parallel_draw_dispatch_callback;
+    unit->base_unit.evaluate_cb = lv_parallel_draw_evaluate_callback;
+    unit->base_unit.delete_cb = lv_parallel_draw_delete_callback;
+    unit->context = context;
+
+    g_parallel_draw_unit = unit;
+
+    return true;
+}
+
+bool lv_parallel_draw_set_tile_size(
+    int32_t width,
+    int32_t height)
+{
+    if (!g_parallel_draw_unit || width < 0 || height < 0)
+    {
+        return false;
+    }
+
+    lv_parallel_draw_context_t* context = g_parallel_draw_unit->context;
+    context->tile_width = width;
+    context->tile_height = height;
+
+    return true;
+}
+
+bool lv_parallel_draw_get_stats(
+    lv_parallel_draw_stats_t* stats)
+{
+    if (!stats || !g_parallel_draw_unit)
+    {
+        return false;
+    }
+
+    lv_parallel_draw_context_t* context = g_parallel_draw_unit->context;
+    stats->worker_count = static_cast<uint32_t>(context->workers.size());
+    stats->dispatched_task_count =
+        context->dispatched_task_count.load(std::memory_order_relaxed);
+    stats->executed_task_count =
+        context->executed_task_count.load(std::memory_order_relaxed);
+    stats->stolen_task_count =
+        context->stolen_task_count.load(std::memory_order_relaxed);
+    stats->split_task_count = context->split_task_count;
+    stats->tile_count = context->tile_count;
+
+    return true;
+}
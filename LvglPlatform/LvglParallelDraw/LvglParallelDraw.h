@@ -0,0 +1,114 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglParallelDraw.h
+ * PURPOSE:   Definition for the work-stealing parallel software draw unit
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#ifndef LVGL_PARALLEL_DRAW_H
+#define LVGL_PARALLEL_DRAW_H
+
+#include "lvgl/lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The draw unit ID used for claiming the draw tasks, which is chosen to
+ *        not conflict with the draw unit IDs defined by LVGL.
+ */
+#define LV_PARALLEL_DRAW_UNIT_ID 0x40
+
+/**
+ * @brief The maximum number of worker threads of the parallel draw unit.
+ */
+#define LV_PARALLEL_DRAW_MAX_WORKERS 16
+
+/**
+ * @brief The default tile width in pixels of the tile mode. 0 means the tiles
+ *        span the whole width of the draw area, which keeps every tile as
+ *        contiguous rows of the layer buffer.
+ */
+#ifndef LV_PARALLEL_DRAW_TILE_WIDTH
+#define LV_PARALLEL_DRAW_TILE_WIDTH 0
+#endif
+
+/**
+ * @brief The default tile height in pixels of the tile mode. 0 means the tile
+ *        mode is disabled.
+ */
+#ifndef LV_PARALLEL_DRAW_TILE_HEIGHT
+#define LV_PARALLEL_DRAW_TILE_HEIGHT 64
+#endif
+
+typedef struct _lv_parallel_draw_stats_t
+{
+    uint32_t worker_count;
+    uint64_t dispatched_task_count;
+    uint64_t executed_task_count;
+    uint64_t stolen_task_count;
+    uint64_t split_task_count;
+    uint64_t tile_count;
+} lv_parallel_draw_stats_t;
+
+/**
+ * @brief Creates the parallel software draw unit, which claims the draw tasks
+ *        the software draw units of LVGL handle poorly, and executes them on a
+ *        pool of worker threads. Every worker has its own task deque, and the
+ *        idle workers steal the pending tasks from the other workers, so a
+ *        worker stuck on a large task doesn't leave the others idle.
+ * @param worker_count The number of worker threads. 0 means one worker per
+ *                     processor. The value is capped to
+ *                     LV_PARALLEL_DRAW_MAX_WORKERS.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark This function should be called after lv_init. The draw unit is
+ *         deleted by lv_deinit. Only two kinds of draw tasks are claimed, with
+ *         the preference score 99, which is slightly preferred over the
+ *         software draw units of LVGL and loses to any hardware accelerated
+ *         draw unit: the rounded fills, which are drawn with the corner masks
+ *         of LvglCircleCache, and the fills, borders, layers and images
+ *         covering more than one tile, which are split into tiles. The other
+ *         tasks, including the box shadows, are left to the software draw
+ *         units, so the work stealing only balances the claimed tasks among
+ *         the workers. The dependencies between the draw tasks are still
+ *         resolved by LVGL, because only the independent tasks are dispatched
+ *         to the workers. The bookkeeping of the split tasks is allocated from
+ *         the frame arena of LvglSlabAllocator, so LvglCircleCache and
+ *         LvglSlabAllocator are required.
+ */
+bool lv_parallel_draw_init(
+    uint32_t worker_count);
+
+/**
+ * @brief Sets the tile size of the tile mode, which splits the draw tasks
+ *        covering more than one tile into tiles rendered in parallel, e.g. the
+ *        full screen background fill when a screen is loaded.
+ * @param width The tile width in pixels. 0 means the whole width of the draw
+ *              area.
+ * @param height The tile height in pixels. 0 means the tile mode is disabled.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark The defaults are LV_PARALLEL_DRAW_TILE_WIDTH and
+ *         LV_PARALLEL_DRAW_TILE_HEIGHT, which can be overridden by the
+ *         preprocessor definitions of the project.
+ */
+bool lv_parallel_draw_set_tile_size(
+    int32_t width,
+    int32_t height);
+
+/**
+ * @brief Gets the statistics of the parallel software draw unit.
+ * @param stats The statistics of the parallel software draw unit.
+ * @return If succeed, return true. Otherwise, return false.
+ */
+bool lv_parallel_draw_get_stats(
+    lv_parallel_draw_stats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !LVGL_PARALLEL_DRAW_H */
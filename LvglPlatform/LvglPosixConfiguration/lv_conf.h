@@ -0,0 +1,56 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      lv_conf.h
+ * PURPOSE:   LVGL configuration overrides for building on POSIX hosts
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+/*
+ * This file is only used by the CMake build on non-Windows hosts. It includes
+ * the lv_conf.h of the selected project via #include_next and replaces the
+ * Windows specific options, so the original lv_conf.h files which are also
+ * maintained by MigrateLvglConfiguration needn't be modified.
+ */
+
+#ifndef LVGL_POSIX_CONFIGURATION_H
+#define LVGL_POSIX_CONFIGURATION_H
+
+#include_next "lv_conf.h"
+
+#undef LV_USE_OS
+#define LV_USE_OS LV_OS_PTHREAD
+
+#undef LV_USE_FS_WIN32
+#define LV_USE_FS_WIN32 0
+
+#undef LV_USE_WINDOWS
+#define LV_USE_WINDOWS 0
+
+/*
+ * Set by the LVGL_DRAW_SW_DRAW_UNIT_CNT option of the CMake project, which is
+ * used for measuring the scaling of the software renderer with the number of
+ * draw threads.
+ */
+#ifdef LVGL_DRAW_SW_DRAW_UNIT_CNT
+#undef LV_DRAW_SW_DRAW_UNIT_CNT
+#define LV_DRAW_SW_DRAW_UNIT_CNT LVGL_DRAW_SW_DRAW_UNIT_CNT
+#endif
+
+/*
+ * Set by the LVGL_STDLIB_MALLOC option of the CMake project, which is used for
+ * comparing the allocator backends. The builtin allocator gets a pool large
+ * enough for the demos, because the pool options of lv_conf.h are only
+ * defined if the builtin allocator is selected there.
+ */
+#ifdef LVGL_STDLIB_MALLOC
+#undef LV_USE_STDLIB_MALLOC
+#define LV_USE_STDLIB_MALLOC LVGL_STDLIB_MALLOC
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && !defined(LV_MEM_SIZE)
+#define LV_MEM_SIZE (16 * 1024 * 1024U)
+#endif
+#endif
+
+#endif /* !LVGL_POSIX_CONFIGURATION_H */
@@ -0,0 +1,659 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglProfilerTrace.cpp
+ * PURPOSE:   Implementation for the per-thread trace buffers of the LVGL
+ *            profiler
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglProfilerTrace.h"
+
+#include "lvgl/lvgl.h"
+#include "lvgl/src/lvgl_private.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <csignal>
+#include <pthread.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define LV_PROFILER_TRACE_DRAIN_PERIOD 100
+#define LV_PROFILER_TRACE_CALIBRATION_COUNT (LV_PROFILER_TRACE_BUFFER_SIZE / 4)
+// The number of the threads recording at the same time in the parallel pass of
+// the calibration, which matches the draw threads of a busy frame.
+#define LV_PROFILER_TRACE_CALIBRATION_THREAD_COUNT 8
+
+static_assert(
+    0 == (LV_PROFILER_TRACE_BUFFER_SIZE & (LV_PROFILER_TRACE_BUFFER_SIZE - 1)),
+    "LV_PROFILER_TRACE_BUFFER_SIZE must be a power of 2");
+
+typedef struct _lv_profiler_trace_event_t
+{
+    uint64_t time;
+    const char* tag;
+    int32_t thread_id;
+    // 'B' for the beginning and 'E' for the end of a scope.
+    char phase;
+} lv_profiler_trace_event_t;
+
+// The single producer is the owner thread, and the single consumer is the
+// thread which drains the buffers with the mutex of the trace held.
+typedef struct _lv_profiler_trace_buffer_t
+{
+    std::atomic<uint32_t> head{ 0 };
+    std::atomic<uint32_t> tail{ 0 };
+    std::atomic<uint64_t> dropped_count{ 0 };
+    int32_t thread_id = 0;
+    lv_profiler_trace_event_t events[LV_PROFILER_TRACE_BUFFER_SIZE];
+} lv_profiler_trace_buffer_t;
+
+static struct
+{
+    std::atomic<bool> enabled;
+    std::mutex mutex;
+    // The buffers are kept after their threads exit, so the remaining events
+    // can still be drained.
+    std::vector<std::unique_ptr<lv_profiler_trace_buffer_t>> buffers;
+    // The latest drained events, which are at most
+    // LV_PROFILER_TRACE_MAX_EVENTS.
+    std::deque<lv_profiler_trace_event_t> events;
+    uint64_t discarded_count;
+    // The average time in nanoseconds of recording an event, measured when
+    // starting on the current thread alone and on
+    // LV_PROFILER_TRACE_CALIBRATION_THREAD_COUNT threads at the same time.
+    uint64_t record_cost;
+    uint64_t parallel_record_cost;
+    std::map<int32_t, std::string> thread_names;
+    std::string file_path;
+    lv_timer_t* drain_timer;
+} g_trace;
+
+#if LV_USE_WINDOWS
+
+#define LV_PROFILER_TRACE_WINDOW_PROCEDURE_PROPERTY \
+    L"LvglProfilerTraceWindowProcedure"
+
+// Set by the window thread of the LVGL Windows backend.
+static std::atomic<bool> g_trace_write_requested{ false };
+
+static LRESULT CALLBACK lv_profiler_trace_window_procedure(
+    HWND window_handle,
+    UINT message,
+    WPARAM wparam,
+    LPARAM lparam)
+{
+    WNDPROC original_procedure = reinterpret_cast<WNDPROC>(::GetPropW(
+        window_handle,
+        LV_PROFILER_TRACE_WINDOW_PROCEDURE_PROPERTY));
+
+    // Bit 30 of lparam is set for the repeated key down messages.
+    if (WM_KEYDOWN == message && VK_F12 == wparam && !(lparam & (1 << 30)))
+    {
+        g_trace_write_requested.store(true, std::memory_order_relaxed);
+    }
+
+    if (WM_NCDESTROY == message)
+    {
+        ::SetWindowLongPtrW(
+            window_handle,
+            GWLP_WNDPROC,
+            reinterpret_cast<LONG_PTR>(original_procedure));
+        ::RemovePropW(
+            window_handle,
+            LV_PROFILER_TRACE_WINDOW_PROCEDURE_PROPERTY);
+    }
+
+    return ::CallWindowProcW(
+        original_procedure,
+        window_handle,
+        message,
+        wparam,
+        lparam);
+}
+
+#elif !defined(_WIN32)
+static volatile std::sig_atomic_t g_trace_write_requested = 0;
+
+static void lv_profiler_trace_signal_handler(
+    int signal_number)
+{
+    LV_UNUSED(signal_number);
+
+    g_trace_write_requested = 1;
+}
+#endif
+
+static thread_local lv_profiler_trace_buffer_t* g_trace_buffer = NULL;
+// The name set before the first event of the thread.
+static thread_local std::string g_trace_thread_name;
+
+static uint64_t lv_profiler_trace_get_time()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// The threads of the SW draw units are created by LVGL, so they are found by
+// their handles and named by the indexes of their draw units.
+static bool lv_profiler_trace_get_draw_unit_name(
+    std::string& name)
+{
+#if LV_USE_DRAW_SW \
+    && (LV_USE_OS == LV_OS_WINDOWS || LV_USE_OS == LV_OS_PTHREAD)
+    for (lv_draw_unit_t* unit = LV_GLOBAL_DEFAULT()->draw_info.unit_head;
+        unit;
+        unit = unit->next)
+    {
+        if (!unit->name || 0 != std::strcmp(unit->name, "SW"))
+        {
+            continue;
+        }
+
+        lv_draw_sw_unit_t* sw_unit = reinterpret_cast<lv_draw_sw_unit_t*>(unit);
+#if LV_USE_OS == LV_OS_WINDOWS
+        bool current = ::GetThreadId(sw_unit->thread) == ::GetCurrentThreadId();
+#else
+        bool current = 0 != ::pthread_equal(
+            sw_unit->thread.thread,
+            ::pthread_self());
+#endif
+        if (current)
+        {
+            name = "SW draw unit " + std::to_string(sw_unit->idx);
+            return true;
+        }
+    }
+#else
+    LV_UNUSED(name);
+#endif
+
+    return false;
+}
+
+static lv_profiler_trace_buffer_t* lv_profiler_trace_get_buffer()
+{
+    if (g_trace_buffer)
+    {
+        return g_trace_buffer;
+    }
+
+    std::unique_ptr<lv_profiler_trace_buffer_t> buffer(
+        new (std::nothrow) lv_profiler_trace_buffer_t());
+    if (!buffer)
+    {
+        return NULL;
+    }
+
+    if (g_trace_thread_name.empty())
+    {
+        lv_profiler_trace_get_draw_unit_name(g_trace_thread_name);
+    }
+
+    // Number the threads from 1 in the order of their first events, which is
+    // more readable than the identifiers of the system.
+    std::lock_guard<std::mutex> lock(g_trace.mutex);
+    buffer->thread_id = static_cast<int32_t>(g_trace.buffers.size()) + 1;
+    if (!g_trace_thread_name.empty())
+    {
+        g_trace.thread_names[buffer->thread_id] = g_trace_thread_name;
+    }
+    g_trace_buffer = buffer.get();
+    g_trace.buffers.push_back(std::move(buffer));
+
+    return g_trace_buffer;
+}
+
+void lv_profiler_trace_record(
+    const char* tag,
+    char phase)
+{
+    if (!g_trace.enabled.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    lv_profiler_trace_buffer_t* buffer = lv_profiler_trace_get_buffer();
+    if (!buffer)
+    {
+        return;
+    }
+
+    uint32_t head = buffer->head.load(std::memory_order_relaxed);
+    if (head - buffer->tail.load(std::memory_order_acquire)
+        >= LV_PROFILER_TRACE_BUFFER_SIZE)
+    {
+        buffer->dropped_count.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    lv_profiler_trace_event_t& event =
+        buffer->events[head & (LV_PROFILER_TRACE_BUFFER_SIZE - 1)];
+    event.time = lv_profiler_trace_get_time();
+    event.tag = tag;
+    event.thread_id = buffer->thread_id;
+    event.phase = phase;
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+
+static uint64_t lv_profiler_trace_count_dropped()
+{
+    uint64_t dropped_count = 0;
+    for (const auto& buffer : g_trace.buffers)
+    {
+        dropped_count += buffer->dropped_count.load(std::memory_order_relaxed);
+    }
+    return dropped_count;
+}
+
+static void lv_profiler_trace_drain()
+{
+    const size_t drained_count = g_trace.events.size();
+    for (const auto& buffer : g_trace.buffers)
+    {
+        uint32_t head = buffer->head.load(std::memory_order_acquire);
+        uint32_t tail = buffer->tail.load(std::memory_order_relaxed);
+        for (; tail != head; ++tail)
+        {
+            g_trace.events.push_back(
+                buffer->events[tail & (LV_PROFILER_TRACE_BUFFER_SIZE - 1)]);
+        }
+        buffer->tail.store(tail, std::memory_order_release);
+    }
+
+    // Keep a rolling window of the latest events, so a long running session
+    // doesn't grow without bound. The buffers are drained one by one, so every
+    // drained batch is sorted to make the discarded events the oldest ones,
+    // give or take the time of a drain.
+    std::sort(
+        g_trace.events.begin() + drained_count,
+        g_trace.events.end(),
+        [](
+            const lv_profiler_trace_event_t& left,
+            const lv_profiler_trace_event_t& right)
+    {
+        return left.time < right.time;
+    });
+    if (g_trace.events.size() > LV_PROFILER_TRACE_MAX_EVENTS)
+    {
+        size_t discarded_count =
+            g_trace.events.size() - LV_PROFILER_TRACE_MAX_EVENTS;
+        g_trace.events.erase(
+            g_trace.events.begin(),
+            g_trace.events.begin() + discarded_count);
+        g_trace.discarded_count += discarded_count;
+    }
+}
+
+static uint64_t lv_profiler_trace_measure_record()
+{
+    uint64_t start_time = lv_profiler_trace_get_time();
+    for (uint32_t i = 0; i < LV_PROFILER_TRACE_CALIBRATION_COUNT / 2; ++i)
+    {
+        lv_profiler_trace_record(__func__, 'B');
+        lv_profiler_trace_record(__func__, 'E');
+    }
+    return lv_profiler_trace_get_time() - start_time;
+}
+
+static uint64_t lv_profiler_trace_calibrate()
+{
+    // Measure the average cost of recording an event on the current thread,
+    // so the overhead of the trace can be estimated from the event count.
+    return lv_profiler_trace_measure_record()
+        / LV_PROFILER_TRACE_CALIBRATION_COUNT;
+}
+
+static uint64_t lv_profiler_trace_calibrate_parallel()
+{
+    // Measure the average cost of recording an event while the draw threads
+    // record at the same time, which includes the contention on the clock and
+    // the memory bus. The threads record into the buffers which are not
+    // registered, so they are not shown in the trace.
+    std::vector<std::unique_ptr<lv_profiler_trace_buffer_t>> buffers;
+    for (size_t i = 0; i < LV_PROFILER_TRACE_CALIBRATION_THREAD_COUNT; ++i)
+    {
+        std::unique_ptr<lv_profiler_trace_buffer_t> buffer(
+            new (std::nothrow) lv_profiler_trace_buffer_t());
+        if (!buffer)
+        {
+            return 0;
+        }
+        buffers.push_back(std::move(buffer));
+    }
+
+    std::atomic<bool> started{ false };
+    uint64_t elapsed[LV_PROFILER_TRACE_CALIBRATION_THREAD_COUNT] = {};
+    std::vector<std::thread> threads;
+    try
+    {
+        for (size_t i = 0; i < LV_PROFILER_TRACE_CALIBRATION_THREAD_COUNT; ++i)
+        {
+            threads.emplace_back([&, i]()
+            {
+                g_trace_buffer = buffers[i].get();
+                while (!started.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+                elapsed[i] = lv_profiler_trace_measure_record();
+                g_trace_buffer = NULL;
+            });
+        }
+    }
+    catch (...)
+    {
+    }
+    started.store(true, std::memory_order_release);
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    if (LV_PROFILER_TRACE_CALIBRATION_THREAD_COUNT != threads.size())
+    {
+        return 0;
+    }
+
+    uint64_t elapsed_sum = 0;
+    for (uint64_t thread_elapsed : elapsed)
+    {
+        elapsed_sum += thread_elapsed;
+    }
+    return elapsed_sum / (static_cast<uint64_t>(
+        LV_PROFILER_TRACE_CALIBRATION_COUNT)
+        * LV_PROFILER_TRACE_CALIBRATION_THREAD_COUNT);
+}
+
+static void lv_profiler_trace_drain_callback(
+    lv_timer_t* timer)
+{
+    LV_UNUSED(timer);
+
+    {
+        std::lock_guard<std::mutex> lock(g_trace.mutex);
+        lv_profiler_trace_drain();
+    }
+
+#if LV_USE_WINDOWS
+    bool requested = g_trace_write_requested.exchange(
+        false,
+        std::memory_order_relaxed);
+#elif !defined(_WIN32)
+    bool requested = 0 != g_trace_write_requested;
+    g_trace_write_requested = 0;
+#else
+    bool requested = false;
+#endif
+
+    if (requested)
+    {
+        if (lv_profiler_trace_write())
+        {
+            LV_LOG_USER("The profiler trace is written");
+        }
+    }
+}
+
+static void lv_profiler_trace_write_string(
+    std::FILE* file,
+    const char* value)
+{
+    std::fputc('"', file);
+    for (; *value; ++value)
+    {
+        if ('"' == *value || '\\' == *value)
+        {
+            std::fputc('\\', file);
+        }
+        std::fputc(*value, file);
+    }
+    std::fputc('"', file);
+}
+
+bool lv_profiler_trace_start(
+    const char* file_path)
+{
+#if LV_USE_PROFILER
+    if (!file_path)
+    {
+        return false;
+    }
+
+    lv_profiler_trace_set_thread_name("Main");
+
+    g_trace.enabled.store(true, std::memory_order_relaxed);
+    uint64_t record_cost = lv_profiler_trace_calibrate();
+    uint64_t parallel_record_cost = lv_profiler_trace_calibrate_parallel();
+
+    {
+        std::lock_guard<std::mutex> lock(g_trace.mutex);
+        lv_profiler_trace_drain();
+        g_trace.events.clear();
+        g_trace.discarded_count = 0;
+        g_trace.record_cost = record_cost;
+        g_trace.parallel_record_cost = parallel_record_cost;
+        g_trace.file_path = file_path;
+    }
+
+    if (!g_trace.drain_timer)
+    {
+        g_trace.drain_timer = lv_timer_create(
+            lv_profiler_trace_drain_callback,
+            LV_PROFILER_TRACE_DRAIN_PERIOD,
+            NULL);
+        if (!g_trace.drain_timer)
+        {
+            g_trace.enabled.store(false, std::memory_order_relaxed);
+            return false;
+        }
+#ifndef _WIN32
+        std::signal(SIGUSR1, lv_profiler_trace_signal_handler);
+#endif
+    }
+
+    return true;
+#else
+    LV_UNUSED(file_path);
+    return false;
+#endif
+}
+
+bool lv_profiler_trace_write(void)
+{
+    std::lock_guard<std::mutex> lock(g_trace.mutex);
+
+    if (g_trace.file_path.empty())
+    {
+        return false;
+    }
+
+    lv_profiler_trace_drain();
+    std::stable_sort(
+        g_trace.events.begin(),
+        g_trace.events.end(),
+        [](
+            const lv_profiler_trace_event_t& left,
+            const lv_profiler_trace_event_t& right)
+    {
+        return left.time < right.time;
+    });
+
+    uint64_t dropped_count = lv_profiler_trace_count_dropped();
+    if (dropped_count)
+    {
+        LV_LOG_WARN(
+            "%llu profiler events are dropped",
+            static_cast<unsigned long long>(dropped_count));
+    }
+    if (g_trace.discarded_count)
+    {
+        LV_LOG_WARN(
+            "%llu oldest profiler events are discarded",
+            static_cast<unsigned long long>(g_trace.discarded_count));
+    }
+
+    // The estimated time spent on recording the events, summed over all
+    // threads, by the cost on a single thread and on the parallel threads.
+    uint64_t recorded_count = g_trace.events.size() + g_trace.discarded_count;
+    uint64_t overhead_time = recorded_count * g_trace.record_cost;
+    uint64_t parallel_overhead_time =
+        recorded_count * g_trace.parallel_record_cost;
+    LV_LOG_USER(
+        "%llu profiler events are recorded, about %llu ns each on 1 thread "
+        "and %llu ns each on %d threads, %llu us or %llu us in total",
+        static_cast<unsigned long long>(recorded_count),
+        static_cast<unsigned long long>(g_trace.record_cost),
+        static_cast<unsigned long long>(g_trace.parallel_record_cost),
+        LV_PROFILER_TRACE_CALIBRATION_THREAD_COUNT,
+        static_cast<unsigned long long>(overhead_time / 1000),
+        static_cast<unsigned long long>(parallel_overhead_time / 1000));
+
+    std::FILE* file = std::fopen(g_trace.file_path.c_str(), "w");
+    if (!file)
+    {
+        return false;
+    }
+
+    std::fprintf(
+        file,
+        "{\n"
+        "  \"displayTimeUnit\": \"ns\",\n"
+        "  \"otherData\": { \"dropped_events\": %llu, "
+        "\"discarded_events\": %llu, \"record_cost_ns\": %llu, "
+        "\"estimated_overhead_us\": %llu, \"calibration_threads\": %d, "
+        "\"parallel_record_cost_ns\": %llu, "
+        "\"parallel_estimated_overhead_us\": %llu },\n"
+        "  \"traceEvents\": [",
+        static_cast<unsigned long long>(dropped_count),
+        static_cast<unsigned long long>(g_trace.discarded_count),
+        static_cast<unsigned long long>(g_trace.record_cost),
+        static_cast<unsigned long long>(overhead_time / 1000),
+        LV_PROFILER_TRACE_CALIBRATION_THREAD_COUNT,
+        static_cast<unsigned long long>(g_trace.parallel_record_cost),
+        static_cast<unsigned long long>(parallel_overhead_time / 1000));
+
+    bool first = true;
+    for (const auto& buffer : g_trace.buffers)
+    {
+        auto iterator = g_trace.thread_names.find(buffer->thread_id);
+        std::string thread_name = g_trace.thread_names.end() != iterator
+            ? iterator->second
+            : "Thread " + std::to_string(buffer->thread_id);
+
+        std::fprintf(
+            file,
+            "%s\n    { \"name\": \"thread_name\", \"ph\": \"M\", "
+            "\"pid\": 1, \"tid\": %d, \"args\": { \"name\": ",
+            first ? "" : ",",
+            buffer->thread_id);
+        lv_profiler_trace_write_string(file, thread_name.c_str());
+        std::fprintf(file, " } }");
+        first = false;
+    }
+
+    const uint64_t base_time =
+        g_trace.events.empty() ? 0 : g_trace.events.front().time;
+    for (const lv_profiler_trace_event_t& event : g_trace.events)
+    {
+        std::fprintf(file, "%s\n    { \"name\": ", first ? "" : ",");
+        lv_profiler_trace_write_string(file, event.tag ? event.tag : "");
+        std::fprintf(
+            file,
+            ", \"ph\": \"%c\", \"ts\": %.3f, \"pid\": 1, \"tid\": %d }",
+            event.phase,
+            (event.time - base_time) / 1e3,
+            event.thread_id);
+        first = false;
+    }
+
+    std::fprintf(file, "\n  ]\n}\n");
+
+    bool succeeded = !std::ferror(file);
+    succeeded = (0 == std::fclose(file)) && succeeded;
+    return succeeded;
+}
+
+bool lv_profiler_trace_attach_display(
+    lv_display_t* display)
+{
+    if (!display)
+    {
+        return false;
+    }
+
+#if LV_USE_WINDOWS
+    HWND window_handle = lv_windows_get_display_window_handle(display);
+    if (!window_handle)
+    {
+        return false;
+    }
+
+    if (!::GetPropW(window_handle, LV_PROFILER_TRACE_WINDOW_PROCEDURE_PROPERTY))
+    {
+        LONG_PTR original_procedure = ::GetWindowLongPtrW(
+            window_handle,
+            GWLP_WNDPROC);
+        if (!::SetPropW(
+            window_handle,
+            LV_PROFILER_TRACE_WINDOW_PROCEDURE_PROPERTY,
+            reinterpret_cast<HANDLE>(original_procedure)))
+        {
+            return false;
+        }
+
+        // The key messages are received by the window thread of the LVGL
+        // Windows backend, so a short press isn't missed like polling the key
+        // state from the drain timer does.
+        ::SetWindowLongPtrW(
+            window_handle,
+            GWLP_WNDPROC,
+            reinterpret_cast<LONG_PTR>(lv_profiler_trace_window_procedure));
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint64_t lv_profiler_trace_get_dropped_count(void)
+{
+    std::lock_guard<std::mutex> lock(g_trace.mutex);
+    return lv_profiler_trace_count_dropped();
+}
+
+void lv_profiler_trace_set_thread_name(
+    const char* name)
+{
+    if (!name)
+    {
+        return;
+    }
+
+    // The buffer is created by the first event, so the threads which never
+    // record any event needn't have one.
+    g_trace_thread_name = name;
+    if (g_trace_buffer)
+    {
+        std::lock_guard<std::mutex> lock(g_trace.mutex);
+        g_trace.thread_names[g_trace_buffer->thread_id] = name;
+    }
+}
@@ -0,0 +1,116 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglProfilerTrace.h
+ * PURPOSE:   Definition for the per-thread trace buffers of the LVGL profiler
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#ifndef LVGL_PROFILER_TRACE_H
+#define LVGL_PROFILER_TRACE_H
+
+// This header is included by LVGL itself as LV_PROFILER_INCLUDE, so it must
+// not include lvgl.h.
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The number of the events of the trace buffer of every thread, which
+ *        must be a power of 2. The events are dropped when the buffer is full
+ *        and not drained yet.
+ */
+#ifndef LV_PROFILER_TRACE_BUFFER_SIZE
+#define LV_PROFILER_TRACE_BUFFER_SIZE (16 * 1024)
+#endif
+
+/**
+ * @brief The maximum number of the drained events kept for writing the trace.
+ *        The oldest events are discarded beyond it, so the trace holds the
+ *        latest part of a long running session.
+ */
+#ifndef LV_PROFILER_TRACE_MAX_EVENTS
+#define LV_PROFILER_TRACE_MAX_EVENTS (1024 * 1024)
+#endif
+
+/**
+ * @brief The profiler macros of LVGL, which can be used in lv_conf.h with
+ *        LV_PROFILER_INCLUDE set to "LvglProfilerTrace.h".
+ */
+#define LV_PROFILER_TRACE_BEGIN_TAG(tag) lv_profiler_trace_record((tag), 'B')
+#define LV_PROFILER_TRACE_END_TAG(tag) lv_profiler_trace_record((tag), 'E')
+#define LV_PROFILER_TRACE_BEGIN LV_PROFILER_TRACE_BEGIN_TAG(__func__)
+#define LV_PROFILER_TRACE_END LV_PROFILER_TRACE_END_TAG(__func__)
+
+/**
+ * @brief Records the beginning or the end of a scope into the trace buffer of
+ *        the current thread without any lock.
+ * @param tag The name of the scope, which must be valid until the trace is
+ *            written, e.g. __func__ or a string literal.
+ * @param phase 'B' for the beginning and 'E' for the end of the scope.
+ */
+void lv_profiler_trace_record(
+    const char* tag,
+    char phase);
+
+/**
+ * @brief Starts recording the profiler events of every thread, which are
+ *        written to the specified file by lv_profiler_trace_write.
+ * @param file_path The path of the Chrome trace JSON file, which can be
+ *                  opened by Perfetto or chrome://tracing.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark The trace buffers are drained by a timer of LVGL, and the trace is
+ *         also written when F12 is pressed in the windows of the displays
+ *         attached by lv_profiler_trace_attach_display, or when SIGUSR1 is
+ *         received on POSIX hosts. The cost of recording an event is measured
+ *         when starting, on the current thread alone and on 8 threads at the
+ *         same time, and the estimated overheads of the trace are written
+ *         with it. It fails if LV_USE_PROFILER is 0.
+ */
+bool lv_profiler_trace_start(
+    const char* file_path);
+
+/**
+ * @brief Drains the trace buffers of all threads, and writes the events
+ *        recorded since lv_profiler_trace_start to the file, merged in the
+ *        order of their timestamps. At most LV_PROFILER_TRACE_MAX_EVENTS
+ *        latest events are written.
+ * @return If succeed, return true. Otherwise, return false.
+ */
+bool lv_profiler_trace_write(void);
+
+/**
+ * @brief Writes the trace when F12 is pressed in the window of the display.
+ * @param display The display, which must be a Windows display.
+ * @return If succeed, return true. Otherwise, return false.
+ */
+bool lv_profiler_trace_attach_display(
+    struct _lv_display_t* display);
+
+/**
+ * @brief Gets the number of the events dropped because the trace buffers were
+ *        full.
+ * @return The number of the dropped events.
+ */
+uint64_t lv_profiler_trace_get_dropped_count(void);
+
+/**
+ * @brief Sets the name of the current thread shown in the trace. The threads
+ *        of the SW draw units of LVGL are named by the indexes of their draw
+ *        units, and the other threads without name are shown by their
+ *        identifiers.
+ * @param name The name of the current thread.
+ */
+void lv_profiler_trace_set_thread_name(
+    const char* name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !LVGL_PROFILER_TRACE_H */
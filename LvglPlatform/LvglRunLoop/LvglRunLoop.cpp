@@ -0,0 +1,375 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglRunLoop.cpp
+ * PURPOSE:   Implementation for the event-driven run loop of LVGL
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglRunLoop.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#endif
+
+#include <atomic>
+#include <cstdio>
+
+static struct
+{
+    std::atomic<bool> input_pending;
+    std::atomic<uint64_t> handler_count;
+    std::atomic<uint64_t> wait_count;
+    std::atomic<uint64_t> wakeup_count;
+    std::atomic<uint64_t> timeout_count;
+    std::atomic<uint64_t> input_read_count;
+#ifdef _WIN32
+    HANDLE wakeup_event;
+#else
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool wakeup_requested;
+#endif
+    // The last formatted statistics, only accessed from the LVGL thread.
+    uint32_t format_tick;
+    uint64_t format_handler_count;
+    uint64_t format_wait_count;
+} g_run_loop;
+
+#if LV_USE_WINDOWS
+
+#define LV_RUN_LOOP_WINDOW_PROCEDURE_PROPERTY L"LvglRunLoopWindowProcedure"
+
+static bool lv_run_loop_is_input_message(
+    UINT message)
+{
+    if (message >= WM_MOUSEFIRST && message <= WM_MOUSELAST)
+    {
+        return true;
+    }
+
+    if (message >= WM_KEYFIRST && message <= WM_KEYLAST)
+    {
+        return true;
+    }
+
+    switch (message)
+    {
+    case WM_TOUCH:
+    case WM_POINTERUPDATE:
+    case WM_POINTERDOWN:
+    case WM_POINTERUP:
+    case WM_IME_COMPOSITION:
+    case WM_MOUSELEAVE:
+    case WM_SIZE:
+    case WM_DPICHANGED:
+    case WM_CLOSE:
+    case WM_DESTROY:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static LRESULT CALLBACK lv_run_loop_window_procedure(
+    HWND window_handle,
+    UINT message,
+    WPARAM wparam,
+    LPARAM lparam)
+{
+    WNDPROC original_procedure = reinterpret_cast<WNDPROC>(::GetPropW(
+        window_handle,
+        LV_RUN_LOOP_WINDOW_PROCEDURE_PROPERTY));
+
+    LRESULT result = ::CallWindowProcW(
+        original_procedure,
+        window_handle,
+        message,
+        wparam,
+        lparam);
+
+    // Signal after the window procedure of LVGL updated the input state, so
+    // the following read of the input devices sees the new state.
+    if (lv_run_loop_is_input_message(message))
+    {
+        g_run_loop.input_pending.store(true, std::memory_order_release);
+        lv_run_loop_wakeup();
+    }
+
+    if (WM_NCDESTROY == message)
+    {
+        ::SetWindowLongPtrW(
+            window_handle,
+            GWLP_WNDPROC,
+            reinterpret_cast<LONG_PTR>(original_procedure));
+        ::RemovePropW(window_handle, LV_RUN_LOOP_WINDOW_PROCEDURE_PROPERTY);
+    }
+
+    return result;
+}
+
+#endif
+
+#ifndef _WIN32
+static bool lv_run_loop_is_wakeup_requested()
+{
+    return g_run_loop.wakeup_requested;
+}
+#endif
+
+static void lv_run_loop_timer_resume_callback(
+    void* data)
+{
+    LV_UNUSED(data);
+
+    lv_run_loop_wakeup();
+}
+
+static bool lv_run_loop_is_input_active(
+    lv_indev_t* indev)
+{
+    if (LV_INDEV_STATE_PRESSED == lv_indev_get_state(indev))
+    {
+        return true;
+    }
+
+    // The scroll throw is only processed when the input device is read.
+    return NULL != lv_indev_get_scroll_obj(indev);
+}
+
+bool lv_run_loop_init(void)
+{
+#ifdef _WIN32
+    if (!g_run_loop.wakeup_event)
+    {
+        g_run_loop.wakeup_event = ::CreateEventW(
+            NULL,
+            FALSE,
+            FALSE,
+            NULL);
+        if (!g_run_loop.wakeup_event)
+        {
+            return false;
+        }
+    }
+#endif
+
+    lv_timer_handler_set_resume_cb(lv_run_loop_timer_resume_callback, NULL);
+
+    return true;
+}
+
+bool lv_run_loop_attach_display(
+    lv_display_t* display)
+{
+    if (!display)
+    {
+        return false;
+    }
+
+#if LV_USE_WINDOWS
+    HWND window_handle = lv_windows_get_display_window_handle(display);
+    if (!window_handle)
+    {
+        return false;
+    }
+
+    if (!::GetPropW(window_handle, LV_RUN_LOOP_WINDOW_PROCEDURE_PROPERTY))
+    {
+        LONG_PTR original_procedure = ::GetWindowLongPtrW(
+            window_handle,
+            GWLP_WNDPROC);
+        if (!::SetPropW(
+            window_handle,
+            LV_RUN_LOOP_WINDOW_PROCEDURE_PROPERTY,
+            reinterpret_cast<HANDLE>(original_procedure)))
+        {
+            return false;
+        }
+
+        // The window belongs to the window thread of the LVGL Windows
+        // backend, which is in the same process, so it can be subclassed
+        // from here.
+        ::SetWindowLongPtrW(
+            window_handle,
+            GWLP_WNDPROC,
+            reinterpret_cast<LONG_PTR>(lv_run_loop_window_procedure));
+    }
+#endif
+
+    for (lv_indev_t* indev = lv_indev_get_next(NULL);
+        indev;
+        indev = lv_indev_get_next(indev))
+    {
+        if (display == lv_indev_get_display(indev))
+        {
+            lv_indev_set_mode(indev, LV_INDEV_MODE_EVENT);
+        }
+    }
+
+    return true;
+}
+
+void lv_run_loop_wakeup(void)
+{
+#ifdef _WIN32
+    if (g_run_loop.wakeup_event)
+    {
+        ::SetEvent(g_run_loop.wakeup_event);
+    }
+#else
+    {
+        std::lock_guard<std::mutex> lock(g_run_loop.mutex);
+        g_run_loop.wakeup_requested = true;
+    }
+    g_run_loop.condition.notify_one();
+#endif
+}
+
+uint32_t lv_run_loop_handler(void)
+{
+    g_run_loop.handler_count.fetch_add(1, std::memory_order_relaxed);
+
+    bool input_pending = g_run_loop.input_pending.exchange(
+        false,
+        std::memory_order_acq_rel);
+
+    for (lv_indev_t* indev = lv_indev_get_next(NULL);
+        indev;
+        indev = lv_indev_get_next(indev))
+    {
+        if (LV_INDEV_MODE_EVENT != lv_indev_get_mode(indev))
+        {
+            continue;
+        }
+
+        if (input_pending || lv_run_loop_is_input_active(indev))
+        {
+            lv_indev_read(indev);
+            g_run_loop.input_read_count.fetch_add(
+                1,
+                std::memory_order_relaxed);
+        }
+    }
+
+    uint32_t time_till_next = lv_timer_handler();
+
+    for (lv_indev_t* indev = lv_indev_get_next(NULL);
+        indev;
+        indev = lv_indev_get_next(indev))
+    {
+        if (LV_INDEV_MODE_EVENT == lv_indev_get_mode(indev)
+            && lv_run_loop_is_input_active(indev))
+        {
+            time_till_next = LV_MIN(time_till_next, LV_DEF_REFR_PERIOD);
+            break;
+        }
+    }
+
+    return time_till_next;
+}
+
+void lv_run_loop_wait(
+    uint32_t timeout)
+{
+    if (!timeout)
+    {
+        return;
+    }
+
+    g_run_loop.wait_count.fetch_add(1, std::memory_order_relaxed);
+
+    bool woken_up = false;
+
+#ifdef _WIN32
+    woken_up = WAIT_OBJECT_0 == ::WaitForSingleObject(
+        g_run_loop.wakeup_event,
+        LV_NO_TIMER_READY == timeout ? INFINITE : timeout);
+#else
+    std::unique_lock<std::mutex> lock(g_run_loop.mutex);
+    if (LV_NO_TIMER_READY == timeout)
+    {
+        g_run_loop.condition.wait(lock, lv_run_loop_is_wakeup_requested);
+        woken_up = true;
+    }
+    else
+    {
+        woken_up = g_run_loop.condition.wait_for(
+            lock,
+            std::chrono::milliseconds(timeout),
+            lv_run_loop_is_wakeup_requested);
+    }
+    g_run_loop.wakeup_requested = false;
+#endif
+
+    if (woken_up)
+    {
+        g_run_loop.wakeup_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        g_run_loop.timeout_count.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+bool lv_run_loop_get_stats(
+    lv_run_loop_stats_t* stats)
+{
+    if (!stats)
+    {
+        return false;
+    }
+
+    stats->handler_count =
+        g_run_loop.handler_count.load(std::memory_order_relaxed);
+    stats->wait_count =
+        g_run_loop.wait_count.load(std::memory_order_relaxed);
+    stats->wakeup_count =
+        g_run_loop.wakeup_count.load(std::memory_order_relaxed);
+    stats->timeout_count =
+        g_run_loop.timeout_count.load(std::memory_order_relaxed);
+    stats->input_read_count =
+        g_run_loop.input_read_count.load(std::memory_order_relaxed);
+
+    return true;
+}
+
+void lv_run_loop_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_run_loop_stats_t stats;
+    if (!buffer || !buffer_size || !lv_run_loop_get_stats(&stats))
+    {
+        return;
+    }
+
+    uint32_t elapsed = lv_tick_elaps(g_run_loop.format_tick);
+    uint64_t handler_count =
+        stats.handler_count - g_run_loop.format_handler_count;
+    uint64_t wait_count = stats.wait_count - g_run_loop.format_wait_count;
+
+    std::snprintf(
+        buffer,
+        buffer_size,
+        "%u wakeups/s, %u sleeps/s",
+        elapsed
+            ? static_cast<uint32_t>(handler_count * 1000 / elapsed)
+            : 0,
+        elapsed
+            ? static_cast<uint32_t>(wait_count * 1000 / elapsed)
+            : 0);
+
+    g_run_loop.format_tick = lv_tick_get();
+    g_run_loop.format_handler_count = stats.handler_count;
+    g_run_loop.format_wait_count = stats.wait_count;
+}
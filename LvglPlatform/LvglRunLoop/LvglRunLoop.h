@@ -0,0 +1,115 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglRunLoop.h
+ * PURPOSE:   Definition for the event-driven run loop of LVGL
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#ifndef LVGL_RUN_LOOP_H
+#define LVGL_RUN_LOOP_H
+
+#include "lvgl/lvgl.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct _lv_run_loop_stats_t
+{
+    // The number of calls of lv_run_loop_handler, which is the number of
+    // times the run loop woke up.
+    uint64_t handler_count;
+    // The number of calls of lv_run_loop_wait which actually blocked.
+    uint64_t wait_count;
+    // The number of waits ended by lv_run_loop_wakeup.
+    uint64_t wakeup_count;
+    // The number of waits ended by reaching the timeout.
+    uint64_t timeout_count;
+    // The number of times the event driven input devices were read.
+    uint64_t input_read_count;
+} lv_run_loop_stats_t;
+
+/**
+ * @brief Initializes the run loop, which makes LVGL wake up the run loop when
+ *        a timer is created, resumed or made ready.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark It must be called after lv_init and from the thread which runs
+ *         lv_timer_handler.
+ */
+bool lv_run_loop_init(void);
+
+/**
+ * @brief Switches the input devices of the display to the event driven mode,
+ *        and wakes up the run loop when the display receives input from the
+ *        host.
+ * @param display The display.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark The window messages of the Windows displays are used as the input
+ *         signal. The displays without any input source, e.g. the headless
+ *         displays, don't need to be attached.
+ */
+bool lv_run_loop_attach_display(
+    lv_display_t* display);
+
+/**
+ * @brief Wakes up the run loop if it is waiting, or makes the next wait return
+ *        immediately.
+ * @remark It can be called from any thread.
+ */
+void lv_run_loop_wakeup(void);
+
+/**
+ * @brief Reads the event driven input devices which have pending input, and
+ *        runs lv_timer_handler.
+ * @return The time in milliseconds till the next call is needed, which can be
+ *         passed to lv_run_loop_wait. It is LV_NO_TIMER_READY if nothing
+ *         needs to be done until the next wakeup.
+ * @remark While a pointer is pressed or an object is scrolled by the input,
+ *         the input devices are also read every LV_DEF_REFR_PERIOD, so the
+ *         long press detection and the scroll throw keep working.
+ */
+uint32_t lv_run_loop_handler(void);
+
+/**
+ * @brief Blocks the calling thread until the timeout is reached or the run
+ *        loop is woken up.
+ * @param timeout The timeout in milliseconds. LV_NO_TIMER_READY means waiting
+ *                until the run loop is woken up.
+ * @remark Unlike lv_delay_ms, it always waits on the monotonic clock of the
+ *         host, so keep using lv_delay_ms with the synthetic clock of the
+ *         headless display.
+ */
+void lv_run_loop_wait(
+    uint32_t timeout);
+
+/**
+ * @brief Gets the statistics of the run loop.
+ * @param stats The statistics.
+ * @return If succeed, return true. Otherwise, return false.
+ */
+bool lv_run_loop_get_stats(
+    lv_run_loop_stats_t* stats);
+
+/**
+ * @brief Formats the wakeups per second of the run loop since the previous
+ *        call as a single line of text, which can be used as the callback of
+ *        lv_stats_monitor_add_source.
+ * @param buffer The buffer which receives the formatted statistics.
+ * @param buffer_size The size of the buffer in bytes.
+ * @param user_data Unused.
+ */
+void lv_run_loop_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !LVGL_RUN_LOOP_H */
@@ -0,0 +1,392 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglShadowCache.cpp
+ * PURPOSE:   Implementation for the keyed LRU box shadow mask cache
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglShadowCache.h"
+
+#include "lvgl/src/lvgl_private.h"
+
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+typedef struct _lv_shadow_cache_key_t
+{
+    int32_t width;
+    int32_t height;
+    int32_t radius;
+    int32_t blur_width;
+    int32_t spread;
+    int32_t ofs_x;
+    int32_t ofs_y;
+    bool bg_cover;
+
+    bool operator==(const _lv_shadow_cache_key_t& other) const
+    {
+        return this->width == other.width
+            && this->height == other.height
+            && this->radius == other.radius
+            && this->blur_width == other.blur_width
+            && this->spread == other.spread
+            && this->ofs_x == other.ofs_x
+            && this->ofs_y == other.ofs_y
+            && this->bg_cover == other.bg_cover;
+    }
+} lv_shadow_cache_key_t;
+
+typedef struct _lv_shadow_cache_key_hash_t
+{
+    size_t operator()(const lv_shadow_cache_key_t& key) const
+    {
+        const int32_t values[] =
+        {
+            key.width,
+            key.height,
+            key.radius,
+            key.blur_width,
+            key.spread,
+            key.ofs_x,
+            key.ofs_y,
+            key.bg_cover ? 1 : 0
+        };
+
+        size_t result = 0;
+        for (int32_t value : values)
+        {
+            result ^= std::hash<int32_t>()(value)
+                + 0x9E3779B9 + (result << 6) + (result >> 2);
+        }
+        return result;
+    }
+} lv_shadow_cache_key_hash_t;
+
+typedef struct _lv_shadow_cache_entry_t
+{
+    lv_shadow_cache_key_t key;
+    // The shadow area relative to the top left corner of the box.
+    lv_area_t area;
+    size_t size;
+    std::once_flag rendered;
+    bool valid = false;
+    std::vector<lv_opa_t> mask;
+} lv_shadow_cache_entry_t;
+
+typedef std::shared_ptr<lv_shadow_cache_entry_t> lv_shadow_cache_entry_ptr_t;
+
+static struct
+{
+    std::mutex mutex;
+    size_t budget = LV_SHADOW_CACHE_SIZE;
+    size_t used_size = 0;
+    // The most recently used entry is at the front.
+    std::list<lv_shadow_cache_entry_ptr_t> entries;
+    std::unordered_map<
+        lv_shadow_cache_key_t,
+        std::list<lv_shadow_cache_entry_ptr_t>::iterator,
+        lv_shadow_cache_key_hash_t> index;
+    uint64_t hit_count = 0;
+    uint64_t miss_count = 0;
+    uint64_t eviction_count = 0;
+    uint64_t bypass_count = 0;
+} g_shadow_cache;
+
+static void lv_shadow_cache_evict(
+    size_t budget)
+{
+    while (!g_shadow_cache.entries.empty()
+        && g_shadow_cache.used_size > budget)
+    {
+        const lv_shadow_cache_entry_ptr_t& entry =
+            g_shadow_cache.entries.back();
+        g_shadow_cache.used_size -= entry->size;
+        g_shadow_cache.index.erase(entry->key);
+        g_shadow_cache.entries.pop_back();
+        ++g_shadow_cache.eviction_count;
+    }
+}
+
+static void lv_shadow_cache_remove(
+    const lv_shadow_cache_entry_ptr_t& entry)
+{
+    std::lock_guard<std::mutex> lock(g_shadow_cache.mutex);
+
+    auto iterator = g_shadow_cache.index.find(entry->key);
+    if (iterator != g_shadow_cache.index.end()
+        && *iterator->second == entry)
+    {
+        g_shadow_cache.used_size -= entry->size;
+        g_shadow_cache.entries.erase(iterator->second);
+        g_shadow_cache.index.erase(iterator);
+    }
+}
+
+static lv_shadow_cache_entry_ptr_t lv_shadow_cache_acquire(
+    const lv_shadow_cache_key_t& key,
+    const lv_area_t& area)
+{
+    size_t size = static_cast<size_t>(lv_area_get_size(&area));
+
+    std::lock_guard<std::mutex> lock(g_shadow_cache.mutex);
+
+    auto iterator = g_shadow_cache.index.find(key);
+    if (iterator != g_shadow_cache.index.end())
+    {
+        ++g_shadow_cache.hit_count;
+        g_shadow_cache.entries.splice(
+            g_shadow_cache.entries.begin(),
+            g_shadow_cache.entries,
+            iterator->second);
+        return g_shadow_cache.entries.front();
+    }
+
+    // Caching a shadow larger than the half of the budget would flush most of
+    // the other entries for a single shadow, e.g. a full screen window.
+    if (size > g_shadow_cache.budget / 2)
+    {
+        ++g_shadow_cache.bypass_count;
+        return nullptr;
+    }
+
+    ++g_shadow_cache.miss_count;
+    lv_shadow_cache_evict(g_shadow_cache.budget - size);
+
+    lv_shadow_cache_entry_ptr_t entry =
+        std::make_shared<lv_shadow_cache_entry_t>();
+    entry->key = key;
+    entry->area = area;
+    entry->size = size;
+    g_shadow_cache.entries.push_front(entry);
+    g_shadow_cache.index.emplace(key, g_shadow_cache.entries.begin());
+    g_shadow_cache.used_size += size;
+
+    return entry;
+}
+
+static bool lv_shadow_cache_render(
+    lv_draw_task_t* t,
+    const lv_draw_box_shadow_dsc_t* dsc,
+    const lv_area_t* coords,
+    const lv_area_t* shadow_area,
+    std::vector<lv_opa_t>& mask)
+{
+    int32_t width = lv_area_get_width(shadow_area);
+    int32_t height = lv_area_get_height(shadow_area);
+
+    lv_draw_buf_t* draw_buf = lv_draw_buf_create(
+        static_cast<uint32_t>(width),
+        static_cast<uint32_t>(height),
+        LV_COLOR_FORMAT_ARGB8888,
+        LV_STRIDE_AUTO);
+    if (!draw_buf)
+    {
+        return false;
+    }
+    lv_draw_buf_clear(draw_buf, NULL);
+
+    // Render the shadow in opaque white into a transparent layer, so the alpha
+    // channel of the layer is the shadow mask.
+    lv_layer_t layer;
+    lv_layer_init(&layer);
+    layer.draw_buf = draw_buf;
+    layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+    layer.buf_area = *shadow_area;
+    layer._clip_area = *shadow_area;
+    layer.phy_clip_area = *shadow_area;
+
+    lv_draw_task_t mask_task = *t;
+    mask_task.target_layer = &layer;
+    mask_task.clip_area = *shadow_area;
+
+    lv_draw_box_shadow_dsc_t mask_dsc = *dsc;
+    mask_dsc.color = lv_color_white();
+    mask_dsc.opa = LV_OPA_COVER;
+
+    lv_draw_sw_box_shadow(&mask_task, &mask_dsc, coords);
+
+    mask.resize(static_cast<size_t>(width) * height);
+    for (int32_t y = 0; y < height; ++y)
+    {
+        const uint8_t* source =
+            draw_buf->data + static_cast<size_t>(draw_buf->header.stride) * y;
+        lv_opa_t* destination = &mask[static_cast<size_t>(width) * y];
+        for (int32_t x = 0; x < width; ++x)
+        {
+            destination[x] = source[x * 4 + 3];
+        }
+    }
+
+    lv_draw_buf_destroy(draw_buf);
+
+    return true;
+}
+
+bool lv_shadow_cache_draw(
+    lv_draw_task_t* t,
+    const lv_draw_box_shadow_dsc_t* dsc,
+    const lv_area_t* coords)
+{
+    if (!t || !dsc || !coords)
+    {
+        return false;
+    }
+
+    if (dsc->opa <= LV_OPA_MIN)
+    {
+        return true;
+    }
+
+    // The same shadow area as the one calculated by lv_draw_sw_box_shadow.
+    lv_area_t core_area;
+    core_area.x1 = coords->x1 + dsc->ofs_x - dsc->spread;
+    core_area.x2 = coords->x2 + dsc->ofs_x + dsc->spread;
+    core_area.y1 = coords->y1 + dsc->ofs_y - dsc->spread;
+    core_area.y2 = coords->y2 + dsc->ofs_y + dsc->spread;
+
+    lv_area_t shadow_area = core_area;
+    lv_area_increase(&shadow_area, dsc->width / 2 + 1, dsc->width / 2 + 1);
+
+    lv_area_t draw_area;
+    if (!lv_area_intersect(&draw_area, &shadow_area, &t->clip_area))
+    {
+        return true;
+    }
+
+    int32_t width = lv_area_get_width(coords);
+    int32_t height = lv_area_get_height(coords);
+    if (width <= 0 || height <= 0)
+    {
+        return false;
+    }
+
+    lv_shadow_cache_key_t key;
+    key.width = width;
+    key.height = height;
+    // The radius is clamped by LVGL to the half of the shorter side of the box
+    // and the core area, so the larger radii, e.g. LV_RADIUS_CIRCLE, render
+    // the same mask.
+    key.radius = LV_MIN(
+        dsc->radius,
+        LV_MAX(
+            LV_MIN(width, height),
+            LV_MIN(
+                lv_area_get_width(&core_area),
+                lv_area_get_height(&core_area))) >> 1);
+    key.blur_width = dsc->width;
+    key.spread = dsc->spread;
+    key.ofs_x = dsc->ofs_x;
+    key.ofs_y = dsc->ofs_y;
+    key.bg_cover = dsc->bg_cover;
+
+    lv_area_t relative_area = shadow_area;
+    lv_area_move(&relative_area, -coords->x1, -coords->y1);
+
+    lv_shadow_cache_entry_ptr_t entry =
+        lv_shadow_cache_acquire(key, relative_area);
+    if (!entry)
+    {
+        return false;
+    }
+
+    // The workers drawing the other tiles of the same shadow wait here until
+    // the mask is rendered, instead of rendering it again.
+    std::call_once(entry->rendered, [&]()
+    {
+        entry->valid = lv_shadow_cache_render(
+            t,
+            dsc,
+            coords,
+            &shadow_area,
+            entry->mask);
+    });
+    if (!entry->valid)
+    {
+        lv_shadow_cache_remove(entry);
+        return false;
+    }
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    std::memset(&blend_dsc, 0, sizeof(blend_dsc));
+    blend_dsc.blend_area = &shadow_area;
+    blend_dsc.mask_buf = entry->mask.data();
+    blend_dsc.mask_area = &shadow_area;
+    blend_dsc.mask_stride = lv_area_get_width(&shadow_area);
+    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+    blend_dsc.color = dsc->color;
+    blend_dsc.opa = dsc->opa > LV_OPA_MAX ? LV_OPA_COVER : dsc->opa;
+    blend_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    lv_draw_sw_blend(t, &blend_dsc);
+
+    return true;
+}
+
+void lv_shadow_cache_set_budget(
+    size_t budget)
+{
+    std::lock_guard<std::mutex> lock(g_shadow_cache.mutex);
+
+    g_shadow_cache.budget = budget;
+    lv_shadow_cache_evict(budget);
+}
+
+bool lv_shadow_cache_get_stats(
+    lv_shadow_cache_stats_t* stats)
+{
+    if (!stats)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(g_shadow_cache.mutex);
+
+    stats->budget = g_shadow_cache.budget;
+    stats->used_size = g_shadow_cache.used_size;
+    stats->entry_count = static_cast<uint32_t>(g_shadow_cache.entries.size());
+    stats->hit_count = g_shadow_cache.hit_count;
+    stats->miss_count = g_shadow_cache.miss_count;
+    stats->eviction_count = g_shadow_cache.eviction_count;
+    stats->bypass_count = g_shadow_cache.bypass_count;
+
+    return true;
+}
+
+void lv_shadow_cache_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_shadow_cache_stats_t stats;
+    if (!buffer || !buffer_size || !lv_shadow_cache_get_stats(&stats))
+    {
+        return;
+    }
+
+    uint64_t lookup_count = stats.hit_count + stats.miss_count;
+    std::snprintf(
+        buffer,
+        buffer_size,
+        "%u entries, %zu/%zu KiB, %llu hits (%u%%), %llu misses, "
+        "%llu evictions, %llu bypassed",
+        stats.entry_count,
+        stats.used_size / 1024,
+        stats.budget / 1024,
+        static_cast<unsigned long long>(stats.hit_count),
+        lookup_count
+            ? static_cast<uint32_t>(stats.hit_count * 100 / lookup_count)
+            : 0,
+        static_cast<unsigned long long>(stats.miss_count),
+        static_cast<unsigned long long>(stats.eviction_count),
+        static_cast<unsigned long long>(stats.bypass_count));
+}
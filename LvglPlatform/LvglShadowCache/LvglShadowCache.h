@@ -0,0 +1,102 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglShadowCache.h
+ * PURPOSE:   Definition for the keyed LRU box shadow mask cache
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#ifndef LVGL_SHADOW_CACHE_H
+#define LVGL_SHADOW_CACHE_H
+
+#include "lvgl/lvgl.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The default budget in bytes of the shadow mask cache. Every cached
+ *        shadow costs one byte per pixel of the shadow area, so the default is
+ *        enough for the card shadows of lv_demo_widgets on a 800x480 display.
+ */
+#ifndef LV_SHADOW_CACHE_SIZE
+#define LV_SHADOW_CACHE_SIZE (1024 * 1024)
+#endif
+
+typedef struct _lv_shadow_cache_stats_t
+{
+    size_t budget;
+    size_t used_size;
+    uint32_t entry_count;
+    uint64_t hit_count;
+    uint64_t miss_count;
+    uint64_t eviction_count;
+    // The shadows drawn without the cache because they are larger than the
+    // half of the budget.
+    uint64_t bypass_count;
+} lv_shadow_cache_stats_t;
+
+/**
+ * @brief Draws a box shadow with the shadow mask cache, which is keyed by the
+ *        size of the box, the radius, the blur width, the spread, the offset
+ *        and whether the background covers the box. The color and the opacity
+ *        are applied when blending the cached mask, so the shadows only
+ *        differing in them share the same entry.
+ * @param t The draw task of the box shadow.
+ * @param dsc The draw descriptor of the box shadow.
+ * @param coords The coordinates of the box casting the shadow.
+ * @return If the shadow is drawn, return true. Otherwise, return false, and
+ *         the caller should draw the shadow with lv_draw_sw_box_shadow.
+ * @remark This function is thread-safe, so it can be called by the workers of
+ *         the parallel draw unit. The least recently used entries are evicted
+ *         when the budget is exceeded. The built-in cache of LVGL, which is
+ *         sized by LV_DRAW_SW_SHADOW_CACHE_SIZE, only keeps the last corner
+ *         in a global buffer without locking, so it should stay disabled when
+ *         drawing in parallel.
+ */
+bool lv_shadow_cache_draw(
+    lv_draw_task_t* t,
+    const lv_draw_box_shadow_dsc_t* dsc,
+    const lv_area_t* coords);
+
+/**
+ * @brief Sets the budget of the shadow mask cache.
+ * @param budget The budget in bytes. 0 means the cache is disabled.
+ * @remark The default is LV_SHADOW_CACHE_SIZE, which can be overridden by the
+ *         preprocessor definitions of the project. The entries exceeding the
+ *         new budget are evicted immediately.
+ */
+void lv_shadow_cache_set_budget(
+    size_t budget);
+
+/**
+ * @brief Gets the statistics of the shadow mask cache.
+ * @param stats The statistics of the shadow mask cache.
+ * @return If succeed, return true. Otherwise, return false.
+ */
+bool lv_shadow_cache_get_stats(
+    lv_shadow_cache_stats_t* stats);
+
+/**
+ * @brief Formats the statistics of the shadow mask cache as a single line of
+ *        text, which can be used as the callback of
+ *        lv_stats_monitor_add_source.
+ * @param buffer The buffer which receives the formatted statistics.
+ * @param buffer_size The size of the buffer in bytes.
+ * @param user_data Unused.
+ */
+void lv_shadow_cache_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !LVGL_SHADOW_CACHE_H */
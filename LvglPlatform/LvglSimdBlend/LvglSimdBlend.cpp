@@ -0,0 +1,1188 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglSimdBlend.cpp
+ * PURPOSE:   Implementation for the SIMD blend kernels of the software renderer
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglSimdBlend.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || \
+    defined(__x86_64__) || defined(__i386__)
+#define LV_SIMD_BLEND_X86 1
+#include <emmintrin.h>
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define LV_SIMD_BLEND_TARGET_AVX2
+#else
+#include <cpuid.h>
+#define LV_SIMD_BLEND_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#else
+#define LV_SIMD_BLEND_X86 0
+#endif
+
+#if (defined(_M_ARM64) || defined(__aarch64__)) && LV_SIMD_BLEND_ENABLE_NEON
+#define LV_SIMD_BLEND_NEON 1
+#ifdef _MSC_VER
+#include <arm64_neon.h>
+#else
+#include <arm_neon.h>
+#endif
+#else
+#define LV_SIMD_BLEND_NEON 0
+#endif
+
+typedef enum _lv_simd_blend_instruction_set_t
+{
+    LV_SIMD_BLEND_INSTRUCTION_SET_C,
+#if LV_SIMD_BLEND_X86
+    LV_SIMD_BLEND_INSTRUCTION_SET_SSE2,
+    LV_SIMD_BLEND_INSTRUCTION_SET_AVX2,
+#endif
+#if LV_SIMD_BLEND_NEON
+    LV_SIMD_BLEND_INSTRUCTION_SET_NEON,
+#endif
+    LV_SIMD_BLEND_INSTRUCTION_SET_COUNT
+} lv_simd_blend_instruction_set_t;
+
+static const char* g_instruction_set_names[] =
+{
+    "C",
+#if LV_SIMD_BLEND_X86
+    "SSE2",
+    "AVX2",
+#endif
+#if LV_SIMD_BLEND_NEON
+    "NEON",
+#endif
+};
+
+typedef enum _lv_simd_blend_kernel_t
+{
+    LV_SIMD_BLEND_KERNEL_COLOR,
+    LV_SIMD_BLEND_KERNEL_COLOR_WITH_OPA,
+    LV_SIMD_BLEND_KERNEL_COLOR_WITH_MASK,
+    LV_SIMD_BLEND_KERNEL_COLOR_MIX_MASK_OPA,
+    LV_SIMD_BLEND_KERNEL_IMAGE,
+    LV_SIMD_BLEND_KERNEL_IMAGE_WITH_OPA,
+    LV_SIMD_BLEND_KERNEL_IMAGE_WITH_MASK,
+    LV_SIMD_BLEND_KERNEL_IMAGE_MIX_MASK_OPA,
+    LV_SIMD_BLEND_KERNEL_COUNT
+} lv_simd_blend_kernel_t;
+
+static const char* g_kernel_names[] =
+{
+    "color",
+    "color_with_opa",
+    "color_with_mask",
+    "color_mix_mask_opa",
+    "argb8888",
+    "argb8888_with_opa",
+    "argb8888_with_mask",
+    "argb8888_mix_mask_opa",
+};
+
+/**
+ * @brief Blends a row of pixels.
+ * @param dest The destination XRGB8888 pixels.
+ * @param src The source ARGB8888 pixels for the image kernels, or the single
+ *            XRGB8888 color for the color kernels.
+ * @param mask The mask of the row, or NULL for the kernels without mask.
+ * @param opa The opacity for the kernels with opacity.
+ * @param count The number of pixels.
+ */
+typedef void (*lv_simd_blend_row_t)(
+    uint8_t* dest,
+    const uint8_t* src,
+    const uint8_t* mask,
+    uint8_t opa,
+    int32_t count);
+
+/*
+ * The C implementation, which follows lv_color_24_24_mix and the loops in
+ * lv_draw_sw_blend_to_rgb888.c, is used for the tails of the rows and as the
+ * reference of the self test.
+ */
+
+static inline uint32_t lv_simd_blend_mix2(
+    uint32_t a,
+    uint32_t b)
+{
+    return (a * b) >> 8;
+}
+
+static inline uint32_t lv_simd_blend_mix3(
+    uint32_t a,
+    uint32_t b,
+    uint32_t c)
+{
+    return (a * b * c) >> 16;
+}
+
+template<bool Image, bool Mask, bool Opa>
+static inline uint32_t lv_simd_blend_get_mix(
+    uint32_t alpha,
+    uint32_t mask,
+    uint32_t opa)
+{
+    if (Image)
+    {
+        if (Mask && Opa)
+        {
+            return lv_simd_blend_mix3(alpha, mask, opa);
+        }
+        else if (Mask)
+        {
+            return lv_simd_blend_mix2(alpha, mask);
+        }
+        else if (Opa)
+        {
+            return lv_simd_blend_mix2(alpha, opa);
+        }
+        return alpha;
+    }
+
+    if (Mask && Opa)
+    {
+        return lv_simd_blend_mix2(mask, opa);
+    }
+    else if (Mask)
+    {
+        return mask;
+    }
+    return opa;
+}
+
+static inline void lv_simd_blend_mix_pixel(
+    const uint8_t* src,
+    uint8_t* dest,
+    uint32_t mix)
+{
+    if (mix == 0)
+    {
+        return;
+    }
+
+    if (mix >= LV_OPA_MAX)
+    {
+        dest[0] = src[0];
+        dest[1] = src[1];
+        dest[2] = src[2];
+    }
+    else
+    {
+        uint32_t mix_inv = 255 - mix;
+        dest[0] = static_cast<uint8_t>((src[0] * mix + dest[0] * mix_inv) >> 8);
+        dest[1] = static_cast<uint8_t>((src[1] * mix + dest[1] * mix_inv) >> 8);
+        dest[2] = static_cast<uint8_t>((src[2] * mix + dest[2] * mix_inv) >> 8);
+    }
+}
+
+static void lv_simd_blend_fill_row_c(
+    uint8_t* dest,
+    const uint8_t* src,
+    const uint8_t* mask,
+    uint8_t opa,
+    int32_t count)
+{
+    LV_UNUSED(mask);
+    LV_UNUSED(opa);
+
+    for (int32_t i = 0; i < count; ++i)
+    {
+        std::memcpy(dest + i * 4, src, 4);
+    }
+}
+
+template<bool Image, bool Mask, bool Opa>
+static void lv_simd_blend_row_c(
+    uint8_t* dest,
+    const uint8_t* src,
+    const uint8_t* mask,
+    uint8_t opa,
+    int32_t count)
+{
+    for (int32_t i = 0; i < count; ++i)
+    {
+        const uint8_t* src_px = Image ? src + i * 4 : src;
+        lv_simd_blend_mix_pixel(
+            src_px,
+            dest + i * 4,
+            lv_simd_blend_get_mix<Image, Mask, Opa>(
+                src_px[3],
+                Mask ? mask[i] : 0,
+                opa));
+    }
+}
+
+#if LV_SIMD_BLEND_X86
+
+static inline __m128i lv_simd_blend_select_sse2(
+    __m128i condition,
+    __m128i a,
+    __m128i b)
+{
+    return _mm_or_si128(
+        _mm_and_si128(condition, a),
+        _mm_andnot_si128(condition, b));
+}
+
+/*
+ * Mixes 4 pixels with the per-pixel mix values in the 32-bit lanes, which is
+ * the vectorized lv_color_24_24_mix. The sum of the products is at most
+ * 255 * 255, so 16-bit lanes are enough.
+ */
+static inline __m128i lv_simd_blend_mix_sse2(
+    __m128i src,
+    __m128i dest,
+    __m128i mix)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i max = _mm_set1_epi16(255);
+    const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000));
+
+    __m128i mix16 = _mm_or_si128(mix, _mm_slli_epi32(mix, 16));
+    __m128i mix_lo = _mm_unpacklo_epi32(mix16, mix16);
+    __m128i mix_hi = _mm_unpackhi_epi32(mix16, mix16);
+
+    __m128i result_lo = _mm_srli_epi16(_mm_add_epi16(
+        _mm_mullo_epi16(_mm_unpacklo_epi8(src, zero), mix_lo),
+        _mm_mullo_epi16(
+            _mm_unpacklo_epi8(dest, zero),
+            _mm_sub_epi16(max, mix_lo))), 8);
+    __m128i result_hi = _mm_srli_epi16(_mm_add_epi16(
+        _mm_mullo_epi16(_mm_unpackhi_epi8(src, zero), mix_hi),
+        _mm_mullo_epi16(
+            _mm_unpackhi_epi8(dest, zero),
+            _mm_sub_epi16(max, mix_hi))), 8);
+    __m128i result = _mm_packus_epi16(result_lo, result_hi);
+
+    result = lv_simd_blend_select_sse2(
+        _mm_cmpgt_epi32(mix, _mm_set1_epi32(LV_OPA_MAX - 1)),
+        src,
+        result);
+    result = lv_simd_blend_select_sse2(
+        _mm_cmpeq_epi32(mix, zero),
+        dest,
+        result);
+
+    // The alpha channel of the destination is kept.
+    return lv_simd_blend_select_sse2(alpha, dest, result);
+}
+
+static void lv_simd_blend_fill_row_sse2(
+    uint8_t* dest,
+    const uint8_t* src,
+    const uint8_t* mask,
+    uint8_t opa,
+    int32_t count)
+{
+    uint32_t color;
+    std::memcpy(&color, src, 4);
+    __m128i color_vector = _mm_set1_epi32(static_cast<int>(color));
+
+    int32_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(dest + i * 4),
+            color_vector);
+    }
+
+    lv_simd_blend_fill_row_c(dest + i * 4, src, mask, opa, count - i);
+}
+
+template<bool Image, bool Mask, bool Opa>
+static void lv_simd_blend_row_sse2(
+    uint8_t* dest,
+    const uint8_t* src,
+    const uint8_t* mask,
+    uint8_t opa,
+    int32_t count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i opa_vector = _mm_set1_epi32(opa);
+
+    uint32_t color = 0;
+    if (!Image)
+    {
+        std::memcpy(&color, src, 4);
+    }
+    const __m128i color_vector = _mm_set1_epi32(static_cast<int>(color));
+
+    int32_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i src_vector = Image
+            ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4))
+            : color_vector;
+
+        __m128i mask_vector = zero;
+        if (Mask)
+        {
+            int32_t mask_value;
+            std::memcpy(&mask_value, mask + i, 4);
+            mask_vector = _mm_unpacklo_epi16(
+                _mm_unpacklo_epi8(_mm_cvtsi32_si128(mask_value), zero),
+                zero);
+        }
+
+        // The products of two 8-bit values fit in the low 16 bits of the
+        // 32-bit lanes, so the 16-bit multiplications are exact.
+        __m128i mix;
+        if (Image)
+        {
+            mix = _mm_srli_epi32(src_vector, 24);
+            if (Mask && Opa)
+            {
+                mix = _mm_mulhi_epu16(
+                    _mm_mullo_epi16(mix, mask_vector),
+                    opa_vector);
+            }
+            else if (Mask)
+            {
+                mix = _mm_srli_epi32(_mm_mullo_epi16(mix, mask_vector), 8);
+            }
+            else if (Opa)
+            {
+                mix = _mm_srli_epi32(_mm_mullo_epi16(mix, opa_vector), 8);
+            }
+        }
+        else
+        {
+            if (Mask && Opa)
+            {
+                mix = _mm_srli_epi32(
+                    _mm_mullo_epi16(mask_vector, opa_vector),
+                    8);
+            }
+            else if (Mask)
+            {
+                mix = mask_vector;
+            }
+            else
+            {
+                mix = opa_vector;
+            }
+        }
+
+        __m128i* dest_vector = reinterpret_cast<__m128i*>(dest + i * 4);
+        _mm_storeu_si128(
+            dest_vector,
+            lv_simd_blend_mix_sse2(
+                src_vector,
+                _mm_loadu_si128(dest_vector),
+                mix));
+    }
+
+    lv_simd_blend_row_c<Image, Mask, Opa>(
+        dest + i * 4,
+        Image ? src + i * 4 : src,
+        Mask ? mask + i : mask,
+        opa,
+        count - i);
+}
+
+LV_SIMD_BLEND_TARGET_AVX2
+static inline __m256i lv_simd_blend_select_avx2(
+    __m256i condition,
+    __m256i a,
+    __m256i b)
+{
+    return _mm256_or_si256(
+        _mm256_and_si256(condition, a),
+        _mm256_andnot_si256(condition, b));
+}
+
+/*
+ * The same as lv_simd_blend_mix_sse2 for 8 pixels. The unpack and pack
+ * instructions work in the 128-bit halves, so the pixels and the mix values
+ * are still matched.
+ */
+LV_SIMD_BLEND_TARGET_AVX2
+static inline __m256i lv_simd_blend_mix_avx2(
+    __m256i src,
+    __m256i dest,
+    __m256i mix)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i max = _mm256_set1_epi16(255);
+    const __m256i alpha = _mm256_set1_epi32(static_cast<int>(0xFF000000));
+
+    __m256i mix16 = _mm256_or_si256(mix, _mm256_slli_epi32(mix, 16));
+    __m256i mix_lo = _mm256_unpacklo_epi32(mix16, mix16);
+    __m256i mix_hi = _mm256_unpackhi_epi32(mix16, mix16);
+
+    __m256i result_lo = _mm256_srli_epi16(_mm256_add_epi16(
+        _mm256_mullo_epi16(_mm256_unpacklo_epi8(src, zero), mix_lo),
+        _mm256_mullo_epi16(
+            _mm256_unpacklo_epi8(dest, zero),
+            _mm256_sub_epi16(max, mix_lo))), 8);
+    __m256i result_hi = _mm256_srli_epi16(_mm256_add_epi16(
+        _mm256_mullo_epi16(_mm256_unpackhi_epi8(src, zero), mix_hi),
+        _mm256_mullo_epi16(
+            _mm256_unpackhi_epi8(dest, zero),
+            _mm256_sub_epi16(max, mix_hi))), 8);
+    __m256i result = _mm256_packus_epi16(result_lo, result_hi);
+
+    result = lv_simd_blend_select_avx2(
+        _mm256_cmpgt_epi32(mix, _mm256_set1_epi32(LV_OPA_MAX - 1)),
+        src,
+        result);
+    result = lv_simd_blend_select_avx2(
+        _mm256_cmpeq_epi32(mix, zero),
+        dest,
+        result);
+
+    // The alpha channel of the destination is kept.
+    return lv_simd_blend_select_avx2(alpha, dest, result);
+}
+
+LV_SIMD_BLEND_TARGET_AVX2
+static void lv_simd_blend_fill_row_avx2(
+    uint8_t* dest,
+    const uint8_t* src,
+    const uint8_t* mask,
+    uint8_t opa,
+    int32_t count)
+{
+    uint32_t color;
+    std::memcpy(&color, src, 4);
+    __m256i color_vector = _mm256_set1_epi32(static_cast<int>(color));
+
+    int32_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(dest + i * 4),
+            color_vector);
+    }
+
+    lv_simd_blend_fill_row_sse2(dest + i * 4, src, mask, opa, count - i);
+}
+
+template<bool Image, bool Mask, bool Opa>
+LV_SIMD_BLEND_TARGET_AVX2
+static void lv_simd_blend_row_avx2(
+    uint8_t* dest,
+    const uint8_t* src,
+    const uint8_t* mask,
+    uint8_t opa,
+    int32_t count)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i opa_vector = _mm256_set1_epi32(opa);
+
+    uint32_t color = 0;
+    if (!Image)
+    {
+        std::memcpy(&color, src, 4);
+    }
+    const __m256i color_vector = _mm256_set1_epi32(static_cast<int>(color));
+
+    int32_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i src_vector = Image
+            ? _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(src + i * 4))
+            : color_vector;
+
+        __m256i mask_vector = zero;
+        if (Mask)
+        {
+            mask_vector = _mm256_cvtepu8_epi32(_mm_loadl_epi64(
+                reinterpret_cast<const __m128i*>(mask + i)));
+        }
+
+        __m256i mix;
+        if (Image)
+        {
+            mix = _mm256_srli_epi32(src_vector, 24);
+            if (Mask && Opa)
+            {
+                mix = _mm256_mulhi_epu16(
+                    _mm256_mullo_epi16(mix, mask_vector),
+                    opa_vector);
+            }
+            else if (Mask)
+            {
+                mix = _mm256_srli_epi32(
+                    _mm256_mullo_epi16(mix, mask_vector),
+                    8);
+            }
+            else if (Opa)
+            {
+                mix = _mm256_srli_epi32(
+                    _mm256_mullo_epi16(mix, opa_vector),
+                    8);
+            }
+        }
+        else
+        {
+            if (Mask && Opa)
+            {
+                mix = _mm256_srli_epi32(
+                    _mm256_mullo_epi16(mask_vector, opa_vector),
+                    8);
+            }
+            else if (Mask)
+            {
+                mix = mask_vector;
+            }
+            else
+            {
+                mix = opa_vector;
+            }
+        }
+
+        __m256i* dest_vector = reinterpret_cast<__m256i*>(dest + i * 4);
+        _mm256_storeu_si256(
+            dest_vector,
+            lv_simd_blend_mix_avx2(
+                src_vector,
+                _mm256_loadu_si256(dest_vector),
+                mix));
+    }
+
+    lv_simd_blend_row_sse2<Image, Mask, Opa>(
+        dest + i * 4,
+        Image ? src + i * 4 : src,
+        Mask ? mask + i : mask,
+        opa,
+        count - i);
+}
+
+static bool lv_simd_blend_is_avx2_supported()
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+    {
+        return false;
+    }
+
+    // The operating system needs to save the YMM registers.
+    __cpuid(info, 1);
+    if (!(info[2] & (1 << 27)) || (_xgetbv(0) & 0x6) != 0x6)
+    {
+        return false;
+    }
+
+    __cpuidex(info, 7, 0);
+    return 0 != (info[1] & (1 << 5));
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif /* LV_SIMD_BLEND_X86 */
+
+#if LV_SIMD_BLEND_NEON
+
+/*
+ * Mixes 8 pixels deinterleaved into the channels, which is the vectorized
+ * lv_color_24_24_mix. The alpha channel of the destination is kept.
+ */
+static inline void lv_simd_blend_mix_neon(
+    const uint8x8x4_t& src,
+    uint8x8x4_t& dest,
+    uint8x8_t mix)
+{
+    uint8x8_t mix_inv = vsub_u8(vdup_n_u8(255), mix);
+    uint8x8_t full = vcge_u8(mix, vdup_n_u8(LV_OPA_MAX));
+    uint8x8_t none = vceq_u8(mix, vdup_n_u8(0));
+
+    for (int channel = 0; channel < 3; ++channel)
+    {
+        uint8x8_t result = vshrn_n_u16(
+            vmlal_u8(
+                vmull_u8(src.val[channel], mix),
+                dest.val[channel],
+                mix_inv),
+            8);
+        result = vbsl_u8(full, src.val[channel], result);
+        dest.val[channel] = vbsl_u8(none, dest.val[channel], result);
+    }
+}
+
+static inline uint8x8_t lv_simd_blend_mix2_neon(
+    uint8x8_t a,
+    uint8x8_t b)
+{
+    return vshrn_n_u16(vmull_u8(a, b), 8);
+}
+
+static inline uint8x8_t lv_simd_blend_mix3_neon(
+    uint8x8_t a,
+    uint8x8_t b,
+    uint8x8_t c)
+{
+    uint16x8_t ab = vmull_u8(a, b);
+    uint16x8_t c16 = vmovl_u8(c);
+    uint16x4_t low = vshrn_n_u32(
+        vmull_u16(vget_low_u16(ab), vget_low_u16(c16)),
+        16);
+    uint16x4_t high = vshrn_n_u32(
+        vmull_u16(vget_high_u16(ab), vget_high_u16(c16)),
+        16);
+    return vmovn_u16(vcombine_u16(low, high));
+}
+
+static void lv_simd_blend_fill_row_neon(
+    uint8_t* dest,
+    const uint8_t* src,
+    const uint8_t* mask,
+    uint8_t opa,
+    int32_t count)
+{
+    uint32_t color;
+    std::memcpy(&color, src, 4);
+    uint32x4_t color_vector = vdupq_n_u32(color);
+
+    int32_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        vst1q_u32(reinterpret_cast<uint32_t*>(dest + i * 4), color_vector);
+    }
+
+    lv_simd_blend_fill_row_c(dest + i * 4, src, mask, opa, count - i);
+}
+
+template<bool Image, bool Mask, bool Opa>
+static void lv_simd_blend_row_neon(
+    uint8_t* dest,
+    const uint8_t* src,
+    const uint8_t* mask,
+    uint8_t opa,
+    int32_t count)
+{
+    const uint8x8_t opa_vector = vdup_n_u8(opa);
+
+    uint8x8x4_t color_vector;
+    for (int channel = 0; channel < 4; ++channel)
+    {
+        color_vector.val[channel] = vdup_n_u8(Image ? 0 : src[channel]);
+    }
+
+    int32_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        uint8x8x4_t src_vector = Image
+            ? vld4_u8(src + i * 4)
+            : color_vector;
+        uint8x8_t mask_vector = Mask ? vld1_u8(mask + i) : vdup_n_u8(0);
+
+        uint8x8_t mix;
+        if (Image)
+        {
+            mix = src_vector.val[3];
+            if (Mask && Opa)
+            {
+                mix = lv_simd_blend_mix3_neon(mix, mask_vector, opa_vector);
+            }
+            else if (Mask)
+            {
+                mix = lv_simd_blend_mix2_neon(mix, mask_vector);
+            }
+            else if (Opa)
+            {
+                mix = lv_simd_blend_mix2_neon(mix, opa_vector);
+            }
+        }
+        else
+        {
+            if (Mask && Opa)
+            {
+                mix = lv_simd_blend_mix2_neon(mask_vector, opa_vector);
+            }
+            else if (Mask)
+            {
+                mix = mask_vector;
+            }
+            else
+            {
+                mix = opa_vector;
+            }
+        }
+
+        uint8x8x4_t dest_vector = vld4_u8(dest + i * 4);
+        lv_simd_blend_mix_neon(src_vector, dest_vector, mix);
+        vst4_u8(dest + i * 4, dest_vector);
+    }
+
+    lv_simd_blend_row_c<Image, Mask, Opa>(
+        dest + i * 4,
+        Image ? src + i * 4 : src,
+        Mask ? mask + i : mask,
+        opa,
+        count - i);
+}
+
+#endif /* LV_SIMD_BLEND_NEON */
+
+static const lv_simd_blend_row_t
+g_kernels[LV_SIMD_BLEND_INSTRUCTION_SET_COUNT][LV_SIMD_BLEND_KERNEL_COUNT] =
+{
+    {
+        lv_simd_blend_fill_row_c,
+        lv_simd_blend_row_c<false, false, true>,
+        lv_simd_blend_row_c<false, true, false>,
+        lv_simd_blend_row_c<false, true, true>,
+        lv_simd_blend_row_c<true, false, false>,
+        lv_simd_blend_row_c<true, false, true>,
+        lv_simd_blend_row_c<true, true, false>,
+        lv_simd_blend_row_c<true, true, true>,
+    },
+#if LV_SIMD_BLEND_X86
+    {
+        lv_simd_blend_fill_row_sse2,
+        lv_simd_blend_row_sse2<false, false, true>,
+        lv_simd_blend_row_sse2<false, true, false>,
+        lv_simd_blend_row_sse2<false, true, true>,
+        lv_simd_blend_row_sse2<true, false, false>,
+        lv_simd_blend_row_sse2<true, false, true>,
+        lv_simd_blend_row_sse2<true, true, false>,
+        lv_simd_blend_row_sse2<true, true, true>,
+    },
+    {
+        lv_simd_blend_fill_row_avx2,
+        lv_simd_blend_row_avx2<false, false, true>,
+        lv_simd_blend_row_avx2<false, true, false>,
+        lv_simd_blend_row_avx2<false, true, true>,
+        lv_simd_blend_row_avx2<true, false, false>,
+        lv_simd_blend_row_avx2<true, false, true>,
+        lv_simd_blend_row_avx2<true, true, false>,
+        lv_simd_blend_row_avx2<true, true, true>,
+    },
+#endif
+#if LV_SIMD_BLEND_NEON
+    {
+        lv_simd_blend_fill_row_neon,
+        lv_simd_blend_row_neon<false, false, true>,
+        lv_simd_blend_row_neon<false, true, false>,
+        lv_simd_blend_row_neon<false, true, true>,
+        lv_simd_blend_row_neon<true, false, false>,
+        lv_simd_blend_row_neon<true, false, true>,
+        lv_simd_blend_row_neon<true, true, false>,
+        lv_simd_blend_row_neon<true, true, true>,
+    },
+#endif
+};
+
+static bool lv_simd_blend_is_supported(
+    lv_simd_blend_instruction_set_t instruction_set)
+{
+    switch (instruction_set)
+    {
+    case LV_SIMD_BLEND_INSTRUCTION_SET_C:
+        return true;
+#if LV_SIMD_BLEND_X86
+    case LV_SIMD_BLEND_INSTRUCTION_SET_SSE2:
+        // SSE2 is the baseline of x64, and of all x86 processors supported by
+        // the Windows versions targeted by this project.
+        return true;
+    case LV_SIMD_BLEND_INSTRUCTION_SET_AVX2:
+    {
+        static const bool supported = lv_simd_blend_is_avx2_supported();
+        return supported;
+    }
+#endif
+#if LV_SIMD_BLEND_NEON
+    case LV_SIMD_BLEND_INSTRUCTION_SET_NEON:
+        // NEON is mandatory for ARM64.
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+static lv_simd_blend_instruction_set_t lv_simd_blend_get_best_instruction_set()
+{
+    static const lv_simd_blend_instruction_set_t best = []()
+    {
+        int result = LV_SIMD_BLEND_INSTRUCTION_SET_COUNT - 1;
+        while (!lv_simd_blend_is_supported(
+            static_cast<lv_simd_blend_instruction_set_t>(result)))
+        {
+            --result;
+        }
+        return static_cast<lv_simd_blend_instruction_set_t>(result);
+    }();
+    return best;
+}
+
+static void lv_simd_blend_run(
+    lv_simd_blend_row_t row,
+    uint8_t* dest_buf,
+    int32_t dest_stride,
+    int32_t width,
+    int32_t height,
+    const uint8_t* src_buf,
+    int32_t src_stride,
+    const uint8_t* mask_buf,
+    int32_t mask_stride,
+    uint8_t opa)
+{
+    for (int32_t y = 0; y < height; ++y)
+    {
+        row(dest_buf, src_buf, mask_buf, opa, width);
+        dest_buf += dest_stride;
+        src_buf += src_stride;
+        if (mask_buf)
+        {
+            mask_buf += mask_stride;
+        }
+    }
+}
+
+static lv_result_t lv_simd_blend_fill(
+    lv_simd_blend_kernel_t kernel,
+    lv_draw_sw_blend_fill_dsc_t* dsc,
+    uint32_t dest_px_size)
+{
+    if (dest_px_size != 4)
+    {
+        return LV_RESULT_INVALID;
+    }
+
+    uint32_t color = lv_color_to_u32(dsc->color);
+    uint8_t color_bytes[4];
+    std::memcpy(color_bytes, &color, 4);
+
+    lv_simd_blend_run(
+        g_kernels[lv_simd_blend_get_best_instruction_set()][kernel],
+        static_cast<uint8_t*>(dsc->dest_buf),
+        dsc->dest_stride,
+        dsc->dest_w,
+        dsc->dest_h,
+        color_bytes,
+        0,
+        dsc->mask_buf,
+        dsc->mask_stride,
+        dsc->opa);
+
+    return LV_RESULT_OK;
+}
+
+static lv_result_t lv_simd_blend_image(
+    lv_simd_blend_kernel_t kernel,
+    lv_draw_sw_blend_image_dsc_t* dsc,
+    uint32_t dest_px_size)
+{
+    if (dest_px_size != 4)
+    {
+        return LV_RESULT_INVALID;
+    }
+
+    lv_simd_blend_run(
+        g_kernels[lv_simd_blend_get_best_instruction_set()][kernel],
+        static_cast<uint8_t*>(dsc->dest_buf),
+        dsc->dest_stride,
+        dsc->dest_w,
+        dsc->dest_h,
+        static_cast<const uint8_t*>(dsc->src_buf),
+        dsc->src_stride,
+        dsc->mask_buf,
+        dsc->mask_stride,
+        dsc->opa);
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_simd_blend_color_to_xrgb8888(
+    lv_draw_sw_blend_fill_dsc_t* dsc,
+    uint32_t dest_px_size)
+{
+    return lv_simd_blend_fill(
+        LV_SIMD_BLEND_KERNEL_COLOR,
+        dsc,
+        dest_px_size);
+}
+
+lv_result_t lv_simd_blend_color_to_xrgb8888_with_opa(
+    lv_draw_sw_blend_fill_dsc_t* dsc,
+    uint32_t dest_px_size)
+{
+    return lv_simd_blend_fill(
+        LV_SIMD_BLEND_KERNEL_COLOR_WITH_OPA,
+        dsc,
+        dest_px_size);
+}
+
+lv_result_t lv_simd_blend_color_to_xrgb8888_with_mask(
+    lv_draw_sw_blend_fill_dsc_t* dsc,
+    uint32_t dest_px_size)
+{
+    return lv_simd_blend_fill(
+        LV_SIMD_BLEND_KERNEL_COLOR_WITH_MASK,
+        dsc,
+        dest_px_size);
+}
+
+lv_result_t lv_simd_blend_color_to_xrgb8888_mix_mask_opa(
+    lv_draw_sw_blend_fill_dsc_t* dsc,
+    uint32_t dest_px_size)
+{
+    return lv_simd_blend_fill(
+        LV_SIMD_BLEND_KERNEL_COLOR_MIX_MASK_OPA,
+        dsc,
+        dest_px_size);
+}
+
+lv_result_t lv_simd_blend_argb8888_to_xrgb8888(
+    lv_draw_sw_blend_image_dsc_t* dsc,
+    uint32_t dest_px_size)
+{
+    return lv_simd_blend_image(
+        LV_SIMD_BLEND_KERNEL_IMAGE,
+        dsc,
+        dest_px_size);
+}
+
+lv_result_t lv_simd_blend_argb8888_to_xrgb8888_with_opa(
+    lv_draw_sw_blend_image_dsc_t* dsc,
+    uint32_t dest_px_size)
+{
+    return lv_simd_blend_image(
+        LV_SIMD_BLEND_KERNEL_IMAGE_WITH_OPA,
+        dsc,
+        dest_px_size);
+}
+
+lv_result_t lv_simd_blend_argb8888_to_xrgb8888_with_mask(
+    lv_draw_sw_blend_image_dsc_t* dsc,
+    uint32_t dest_px_size)
+{
+    return lv_simd_blend_image(
+        LV_SIMD_BLEND_KERNEL_IMAGE_WITH_MASK,
+        dsc,
+        dest_px_size);
+}
+
+lv_result_t lv_simd_blend_argb8888_to_xrgb8888_mix_mask_opa(
+    lv_draw_sw_blend_image_dsc_t* dsc,
+    uint32_t dest_px_size)
+{
+    return lv_simd_blend_image(
+        LV_SIMD_BLEND_KERNEL_IMAGE_MIX_MASK_OPA,
+        dsc,
+        dest_px_size);
+}
+
+const char* lv_simd_blend_get_instruction_set(void)
+{
+    return g_instruction_set_names[lv_simd_blend_get_best_instruction_set()];
+}
+
+static bool lv_simd_blend_verify_kernel(
+    lv_simd_blend_instruction_set_t instruction_set,
+    lv_simd_blend_kernel_t kernel,
+    std::mt19937& random)
+{
+    const uint8_t edge_values[] = { 0, 1, 127, 128, 252, 253, 254, 255 };
+
+    auto random_byte = [&random, &edge_values]() -> uint8_t
+    {
+        // Mix the edge cases of the opacity thresholds into the random data.
+        uint32_t value = random();
+        return (value & 0x300)
+            ? static_cast<uint8_t>(value)
+            : edge_values[(value >> 16) % sizeof(edge_values)];
+    };
+
+    for (int iteration = 0; iteration < 1000; ++iteration)
+    {
+        int32_t width = 1 + static_cast<int32_t>(random() % 67);
+        int32_t height = 1 + static_cast<int32_t>(random() % 4);
+        int32_t dest_stride = (width + static_cast<int32_t>(random() % 5)) * 4;
+        int32_t src_stride = (width + static_cast<int32_t>(random() % 5)) * 4;
+        int32_t mask_stride = width + static_cast<int32_t>(random() % 7);
+        uint8_t opa = random_byte();
+
+        std::vector<uint8_t> dest(dest_stride * height);
+        std::vector<uint8_t> src(src_stride * height);
+        std::vector<uint8_t> mask(mask_stride * height);
+        for (auto& value : dest)
+        {
+            value = random_byte();
+        }
+        for (auto& value : src)
+        {
+            value = random_byte();
+        }
+        for (auto& value : mask)
+        {
+            value = random_byte();
+        }
+
+        bool image = kernel >= LV_SIMD_BLEND_KERNEL_IMAGE;
+        bool masked =
+            kernel == LV_SIMD_BLEND_KERNEL_COLOR_WITH_MASK ||
+            kernel == LV_SIMD_BLEND_KERNEL_COLOR_MIX_MASK_OPA ||
+            kernel == LV_SIMD_BLEND_KERNEL_IMAGE_WITH_MASK ||
+            kernel == LV_SIMD_BLEND_KERNEL_IMAGE_MIX_MASK_OPA;
+
+        std::vector<uint8_t> expected = dest;
+        lv_simd_blend_run(
+            g_kernels[LV_SIMD_BLEND_INSTRUCTION_SET_C][kernel],
+            expected.data(),
+            dest_stride,
+            width,
+            height,
+            src.data(),
+            image ? src_stride : 0,
+            masked ? mask.data() : NULL,
+            mask_stride,
+            opa);
+
+        lv_simd_blend_run(
+            g_kernels[instruction_set][kernel],
+            dest.data(),
+            dest_stride,
+            width,
+            height,
+            src.data(),
+            image ? src_stride : 0,
+            masked ? mask.data() : NULL,
+            mask_stride,
+            opa);
+
+        if (expected != dest)
+        {
+            std::fprintf(
+                stderr,
+                "%s %s is not bit-exact (%dx%d, opa %u).\n",
+                g_instruction_set_names[instruction_set],
+                g_kernel_names[kernel],
+                width,
+                height,
+                opa);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static double lv_simd_blend_measure_kernel(
+    lv_simd_blend_instruction_set_t instruction_set,
+    lv_simd_blend_kernel_t kernel)
+{
+    const int32_t width = 800;
+    const int32_t height = 480;
+    const int iterations = 20;
+
+    std::vector<uint8_t> dest(width * height * 4, 0x40);
+    std::vector<uint8_t> src(width * height * 4);
+    std::vector<uint8_t> mask(width * height);
+    for (size_t i = 0; i < src.size(); ++i)
+    {
+        src[i] = static_cast<uint8_t>(i * 7);
+    }
+    for (size_t i = 0; i < mask.size(); ++i)
+    {
+        mask[i] = static_cast<uint8_t>(i * 13);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+    {
+        lv_simd_blend_run(
+            g_kernels[instruction_set][kernel],
+            dest.data(),
+            width * 4,
+            width,
+            height,
+            src.data(),
+            kernel >= LV_SIMD_BLEND_KERNEL_IMAGE ? width * 4 : 0,
+            mask.data(),
+            width,
+            LV_OPA_50);
+    }
+    double elapsed = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start).count();
+
+    return elapsed > 0.0
+        ? static_cast<double>(width) * height * iterations / elapsed
+        : 0.0;
+}
+
+bool lv_simd_blend_self_test(void)
+{
+    bool succeeded = true;
+
+    std::mt19937 random(20240601);
+
+    for (int i = LV_SIMD_BLEND_INSTRUCTION_SET_C + 1;
+        i < LV_SIMD_BLEND_INSTRUCTION_SET_COUNT;
+        ++i)
+    {
+        lv_simd_blend_instruction_set_t instruction_set =
+            static_cast<lv_simd_blend_instruction_set_t>(i);
+        if (!lv_simd_blend_is_supported(instruction_set))
+        {
+            continue;
+        }
+
+        for (int j = 0; j < LV_SIMD_BLEND_KERNEL_COUNT; ++j)
+        {
+            if (!lv_simd_blend_verify_kernel(
+                instruction_set,
+                static_cast<lv_simd_blend_kernel_t>(j),
+                random))
+            {
+                succeeded = false;
+            }
+        }
+    }
+
+    std::printf("kernel");
+    for (int i = 0; i < LV_SIMD_BLEND_INSTRUCTION_SET_COUNT; ++i)
+    {
+        if (lv_simd_blend_is_supported(
+            static_cast<lv_simd_blend_instruction_set_t>(i)))
+        {
+            std::printf(",%s_mpix_per_s", g_instruction_set_names[i]);
+        }
+    }
+    std::printf("\n");
+
+    for (int j = 0; j < LV_SIMD_BLEND_KERNEL_COUNT; ++j)
+    {
+        std::printf("%s", g_kernel_names[j]);
+        for (int i = 0; i < LV_SIMD_BLEND_INSTRUCTION_SET_COUNT; ++i)
+        {
+            lv_simd_blend_instruction_set_t instruction_set =
+                static_cast<lv_simd_blend_instruction_set_t>(i);
+            if (lv_simd_blend_is_supported(instruction_set))
+            {
+                std::printf(
+                    ",%.1f",
+                    lv_simd_blend_measure_kernel(
+                        instruction_set,
+                        static_cast<lv_simd_blend_kernel_t>(j)));
+            }
+        }
+        std::printf("\n");
+    }
+
+    std::printf(
+        "The SIMD blend kernels are %s.\n",
+        succeeded ? "bit-exact" : "NOT bit-exact");
+
+    return succeeded;
+}
@@ -0,0 +1,188 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglSimdBlend.h
+ * PURPOSE:   Definition for the SIMD blend kernels of the software renderer
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+/*
+ * This file is included by the blend implementations of the LVGL software
+ * renderer via LV_DRAW_SW_ASM_CUSTOM_INCLUDE, so it needs to be valid C.
+ */
+
+#ifndef LVGL_SIMD_BLEND_H
+#define LVGL_SIMD_BLEND_H
+
+#include "lvgl/lvgl.h"
+#include "lvgl/src/lvgl_private.h"
+
+/*
+ * The NEON kernels have only been verified against a scalar emulation of the
+ * NEON intrinsics, not on ARM64 hardware or an emulator, so they are disabled
+ * unless LV_SIMD_BLEND_ENABLE_NEON is defined as 1, e.g. via the
+ * LVGL_SIMD_BLEND_NEON CMake option. The ARM64 builds use the C
+ * implementation of the software renderer otherwise.
+ */
+#ifndef LV_SIMD_BLEND_ENABLE_NEON
+#define LV_SIMD_BLEND_ENABLE_NEON 0
+#endif
+
+#if defined(_M_X64) || defined(_M_IX86) || \
+    defined(__x86_64__) || defined(__i386__) || \
+    ((defined(_M_ARM64) || defined(__aarch64__)) && LV_SIMD_BLEND_ENABLE_NEON)
+#define LV_SIMD_BLEND_SUPPORTED 1
+#else
+#define LV_SIMD_BLEND_SUPPORTED 0
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Fills an area of a XRGB8888 buffer with a color.
+ * @param dsc The fill descriptor of the software renderer.
+ * @param dest_px_size The pixel size of the destination buffer in bytes.
+ * @return If the destination is not XRGB8888, return LV_RESULT_INVALID to
+ *         fall back to the C implementation. Otherwise, return LV_RESULT_OK.
+ */
+lv_result_t lv_simd_blend_color_to_xrgb8888(
+    lv_draw_sw_blend_fill_dsc_t* dsc,
+    uint32_t dest_px_size);
+
+/**
+ * @brief Blends a color with an opacity to an area of a XRGB8888 buffer.
+ * @param dsc The fill descriptor of the software renderer.
+ * @param dest_px_size The pixel size of the destination buffer in bytes.
+ * @return If the destination is not XRGB8888, return LV_RESULT_INVALID to
+ *         fall back to the C implementation. Otherwise, return LV_RESULT_OK.
+ */
+lv_result_t lv_simd_blend_color_to_xrgb8888_with_opa(
+    lv_draw_sw_blend_fill_dsc_t* dsc,
+    uint32_t dest_px_size);
+
+/**
+ * @brief Blends a color with a mask to an area of a XRGB8888 buffer.
+ * @param dsc The fill descriptor of the software renderer.
+ * @param dest_px_size The pixel size of the destination buffer in bytes.
+ * @return If the destination is not XRGB8888, return LV_RESULT_INVALID to
+ *         fall back to the C implementation. Otherwise, return LV_RESULT_OK.
+ */
+lv_result_t lv_simd_blend_color_to_xrgb8888_with_mask(
+    lv_draw_sw_blend_fill_dsc_t* dsc,
+    uint32_t dest_px_size);
+
+/**
+ * @brief Blends a color with a mask and an opacity to an area of a XRGB8888
+ *        buffer.
+ * @param dsc The fill descriptor of the software renderer.
+ * @param dest_px_size The pixel size of the destination buffer in bytes.
+ * @return If the destination is not XRGB8888, return LV_RESULT_INVALID to
+ *         fall back to the C implementation. Otherwise, return LV_RESULT_OK.
+ */
+lv_result_t lv_simd_blend_color_to_xrgb8888_mix_mask_opa(
+    lv_draw_sw_blend_fill_dsc_t* dsc,
+    uint32_t dest_px_size);
+
+/**
+ * @brief Blends an ARGB8888 image to an area of a XRGB8888 buffer.
+ * @param dsc The image descriptor of the software renderer.
+ * @param dest_px_size The pixel size of the destination buffer in bytes.
+ * @return If the destination is not XRGB8888, return LV_RESULT_INVALID to
+ *         fall back to the C implementation. Otherwise, return LV_RESULT_OK.
+ */
+lv_result_t lv_simd_blend_argb8888_to_xrgb8888(
+    lv_draw_sw_blend_image_dsc_t* dsc,
+    uint32_t dest_px_size);
+
+/**
+ * @brief Blends an ARGB8888 image with an opacity to an area of a XRGB8888
+ *        buffer.
+ * @param dsc The image descriptor of the software renderer.
+ * @param dest_px_size The pixel size of the destination buffer in bytes.
+ * @return If the destination is not XRGB8888, return LV_RESULT_INVALID to
+ *         fall back to the C implementation. Otherwise, return LV_RESULT_OK.
+ */
+lv_result_t lv_simd_blend_argb8888_to_xrgb8888_with_opa(
+    lv_draw_sw_blend_image_dsc_t* dsc,
+    uint32_t dest_px_size);
+
+/**
+ * @brief Blends an ARGB8888 image with a mask to an area of a XRGB8888
+ *        buffer.
+ * @param dsc The image descriptor of the software renderer.
+ * @param dest_px_size The pixel size of the destination buffer in bytes.
+ * @return If the destination is not XRGB8888, return LV_RESULT_INVALID to
+ *         fall back to the C implementation. Otherwise, return LV_RESULT_OK.
+ */
+lv_result_t lv_simd_blend_argb8888_to_xrgb8888_with_mask(
+    lv_draw_sw_blend_image_dsc_t* dsc,
+    uint32_t dest_px_size);
+
+/**
+ * @brief Blends an ARGB8888 image with a mask and an opacity to an area of a
+ *        XRGB8888 buffer.
+ * @param dsc The image descriptor of the software renderer.
+ * @param dest_px_size The pixel size of the destination buffer in bytes.
+ * @return If the destination is not XRGB8888, return LV_RESULT_INVALID to
+ *         fall back to the C implementation. Otherwise, return LV_RESULT_OK.
+ */
+lv_result_t lv_simd_blend_argb8888_to_xrgb8888_mix_mask_opa(
+    lv_draw_sw_blend_image_dsc_t* dsc,
+    uint32_t dest_px_size);
+
+/**
+ * @brief Gets the name of the instruction set used by the blend kernels.
+ * @return The name of the instruction set, e.g. "AVX2" or "NEON".
+ */
+const char* lv_simd_blend_get_instruction_set(void);
+
+/**
+ * @brief Checks whether every SIMD blend kernel supported by the processor is
+ *        bit-exact against the C implementation with random inputs, and
+ *        prints the throughput of every kernel.
+ * @return If all kernels are bit-exact, return true. Otherwise, return false.
+ */
+bool lv_simd_blend_self_test(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#if LV_SIMD_BLEND_SUPPORTED
+
+/*
+ * The XRGB8888 destination is handled by the RGB888 blend implementation of
+ * the software renderer with a pixel size of 4 bytes.
+ */
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888(dsc, dest_px_size) \
+    lv_simd_blend_color_to_xrgb8888(dsc, dest_px_size)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888_WITH_OPA(dsc, dest_px_size) \
+    lv_simd_blend_color_to_xrgb8888_with_opa(dsc, dest_px_size)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888_WITH_MASK(dsc, dest_px_size) \
+    lv_simd_blend_color_to_xrgb8888_with_mask(dsc, dest_px_size)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888_MIX_MASK_OPA(dsc, dest_px_size) \
+    lv_simd_blend_color_to_xrgb8888_mix_mask_opa(dsc, dest_px_size)
+
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888(dsc, dest_px_size) \
+    lv_simd_blend_argb8888_to_xrgb8888(dsc, dest_px_size)
+
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_OPA(dsc, dest_px_size) \
+    lv_simd_blend_argb8888_to_xrgb8888_with_opa(dsc, dest_px_size)
+
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_MASK(dsc, dest_px_size) \
+    lv_simd_blend_argb8888_to_xrgb8888_with_mask(dsc, dest_px_size)
+
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(dsc, dest_px_size) \
+    lv_simd_blend_argb8888_to_xrgb8888_mix_mask_opa(dsc, dest_px_size)
+
+#endif /* LV_SIMD_BLEND_SUPPORTED */
+
+#endif /* !LVGL_SIMD_BLEND_H */
@@ -0,0 +1,1056 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglSlabAllocator.cpp
+ * PURPOSE:   Implementation for the slab pool and frame arena allocator of LVGL
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglSlabAllocator.h"
+#include "LvglAllocationTracer.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <malloc.h>
+#elif defined(__GLIBC__)
+#include <execinfo.h>
+#include <malloc.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#define LV_SLAB_ALLOCATOR_LARGE_CLASS 0xFFFF
+#define LV_SLAB_ALLOCATOR_LIVE_MAGIC 0x51AB0A11
+#define LV_SLAB_ALLOCATOR_FREED_MAGIC 0x51ABDEAD
+#define LV_SLAB_ALLOCATOR_POISON 0xDD
+
+static constexpr size_t g_slab_allocator_block_sizes[
+    LV_SLAB_ALLOCATOR_CLASS_COUNT] =
+{
+    16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048
+};
+
+#define LV_SLAB_ALLOCATOR_MAX_BLOCK_SIZE 2048
+
+// Every block starts with the header, which keeps the blocks 16-byte aligned
+// and lets lv_free_core and lv_realloc_core find the size class.
+typedef struct _lv_slab_allocator_header_t
+{
+    uint16_t size_class;
+    // The index of the call site if the allocation is sampled, otherwise 0.
+    uint16_t call_site;
+    uint32_t magic;
+    uint64_t size;
+} lv_slab_allocator_header_t;
+
+static_assert(
+    16 == sizeof(lv_slab_allocator_header_t),
+    "The header should keep the blocks 16-byte aligned.");
+
+typedef struct _lv_slab_allocator_class_t
+{
+    std::mutex mutex;
+    // The freed blocks, linked through the first bytes after their headers.
+    lv_slab_allocator_header_t* free_list = NULL;
+    // The part of the last page which is not carved into blocks yet.
+    uint8_t* page_cursor = NULL;
+    uint8_t* page_end = NULL;
+    std::vector<void*> pages;
+    lv_slab_allocator_class_stats_t stats = {};
+} lv_slab_allocator_class_t;
+
+typedef struct _lv_slab_allocator_call_site_t
+{
+    void* frames[LV_SLAB_ALLOCATOR_CALL_SITE_DEPTH];
+    uint64_t allocation_count;
+    uint64_t allocation_size;
+    size_t live_size;
+} lv_slab_allocator_call_site_t;
+
+static struct
+{
+    lv_slab_allocator_class_t classes[LV_SLAB_ALLOCATOR_CLASS_COUNT];
+
+    // The allocations forwarded to the C runtime are counted without a lock,
+    // because they are all of the allocations if the slab pools are disabled.
+    std::atomic<size_t> large_live_count{ 0 };
+    std::atomic<size_t> large_peak_live_count{ 0 };
+    std::atomic<size_t> large_live_size{ 0 };
+    std::atomic<size_t> large_allocated_size{ 0 };
+    std::atomic<uint64_t> large_allocation_count{ 0 };
+
+    std::atomic<size_t> requested_size{ 0 };
+    std::atomic<size_t> allocated_size{ 0 };
+    std::atomic<size_t> peak_allocated_size{ 0 };
+
+    // The call sites are only looked up by the sampled allocations. The first
+    // entry is unused, because 0 means the allocation is not sampled.
+    std::mutex call_site_mutex;
+    lv_slab_allocator_call_site_t call_sites[LV_SLAB_ALLOCATOR_MAX_CALL_SITES];
+
+    std::mutex frame_mutex;
+    uint8_t* frame_buffer = NULL;
+    size_t frame_capacity = 0;
+    size_t frame_used = 0;
+    // The bytes allocated in the current frame, including the blocks which
+    // don't fit into the frame buffer.
+    size_t frame_size = 0;
+    size_t frame_peak_size = 0;
+    uint64_t frame_reset_count = 0;
+    std::vector<void*> frame_overflow_blocks;
+    uint32_t attached_display_count = 0;
+} g_slab_allocator;
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+
+#ifdef _MSC_VER
+#define LV_SLAB_ALLOCATOR_NOINLINE __declspec(noinline)
+#else
+#define LV_SLAB_ALLOCATOR_NOINLINE __attribute__((noinline))
+#endif
+
+static constexpr std::array<uint8_t, LV_SLAB_ALLOCATOR_MAX_BLOCK_SIZE / 16 + 1>
+lv_slab_allocator_make_class_table()
+{
+    std::array<uint8_t, LV_SLAB_ALLOCATOR_MAX_BLOCK_SIZE / 16 + 1> table = {};
+    uint8_t size_class = 0;
+    for (size_t i = 0; i < table.size(); ++i)
+    {
+        while (g_slab_allocator_block_sizes[size_class] < i * 16)
+        {
+            ++size_class;
+        }
+        table[i] = size_class;
+    }
+    return table;
+}
+
+// Maps the requested size rounded up to 16 bytes to the size class.
+static constexpr auto g_slab_allocator_class_table =
+    lv_slab_allocator_make_class_table();
+
+static void lv_slab_allocator_update_peak(
+    std::atomic<size_t>& peak,
+    size_t value)
+{
+    size_t peak_value = peak.load(std::memory_order_relaxed);
+    while (peak_value < value &&
+        !peak.compare_exchange_weak(
+            peak_value,
+            value,
+            std::memory_order_relaxed))
+    {
+    }
+}
+
+static void lv_slab_allocator_add_size(
+    size_t requested_size,
+    size_t allocated_size)
+{
+    g_slab_allocator.requested_size.fetch_add(
+        requested_size,
+        std::memory_order_relaxed);
+    lv_slab_allocator_update_peak(
+        g_slab_allocator.peak_allocated_size,
+        g_slab_allocator.allocated_size.fetch_add(
+            allocated_size,
+            std::memory_order_relaxed) + allocated_size);
+}
+
+static void lv_slab_allocator_remove_size(
+    size_t requested_size,
+    size_t allocated_size)
+{
+    g_slab_allocator.requested_size.fetch_sub(
+        requested_size,
+        std::memory_order_relaxed);
+    g_slab_allocator.allocated_size.fetch_sub(
+        allocated_size,
+        std::memory_order_relaxed);
+}
+
+// Gets the bytes taken by a block of the C runtime, including its rounding.
+static size_t lv_slab_allocator_get_large_size(
+    lv_slab_allocator_header_t* header)
+{
+#ifdef _WIN32
+    return _msize(header);
+#elif defined(__GLIBC__)
+    return malloc_usable_size(header);
+#else
+    return sizeof(lv_slab_allocator_header_t)
+        + static_cast<size_t>(header->size);
+#endif
+}
+
+static void lv_slab_allocator_count_allocation(
+    lv_slab_allocator_class_stats_t& stats,
+    size_t size)
+{
+    ++stats.allocation_count;
+    ++stats.live_count;
+    stats.live_size += size;
+    if (stats.peak_live_count < stats.live_count)
+    {
+        stats.peak_live_count = stats.live_count;
+    }
+}
+
+LV_SLAB_ALLOCATOR_NOINLINE static uint16_t lv_slab_allocator_sample_call_site(
+    size_t size)
+{
+    // Skip this function and lv_malloc_core or lv_realloc_core, so the first
+    // frame is the allocation function of LVGL called.
+    void* frames[LV_SLAB_ALLOCATOR_CALL_SITE_DEPTH + 2] = {};
+#ifdef _WIN32
+    ::RtlCaptureStackBackTrace(
+        2,
+        LV_SLAB_ALLOCATOR_CALL_SITE_DEPTH,
+        frames + 2,
+        NULL);
+#elif defined(__GLIBC__)
+    ::backtrace(frames, LV_SLAB_ALLOCATOR_CALL_SITE_DEPTH + 2);
+#endif
+    void** call_site_frames = frames + 2;
+
+    size_t hash = 0;
+    for (size_t i = 0; i < LV_SLAB_ALLOCATOR_CALL_SITE_DEPTH; ++i)
+    {
+        hash = hash * 31 + reinterpret_cast<uintptr_t>(call_site_frames[i]);
+    }
+    hash ^= hash >> 17;
+
+    std::lock_guard<std::mutex> lock(g_slab_allocator.call_site_mutex);
+
+    // Linear probing in the table, which skips the unused first entry.
+    for (size_t probe = 0; probe < LV_SLAB_ALLOCATOR_MAX_CALL_SITES; ++probe)
+    {
+        size_t index =
+            1 + (hash + probe) % (LV_SLAB_ALLOCATOR_MAX_CALL_SITES - 1);
+        lv_slab_allocator_call_site_t& call_site =
+            g_slab_allocator.call_sites[index];
+
+        if (!call_site.allocation_count)
+        {
+            std::memcpy(
+                call_site.frames,
+                call_site_frames,
+                sizeof(call_site.frames));
+        }
+        else if (0 != std::memcmp(
+            call_site.frames,
+            call_site_frames,
+            sizeof(call_site.frames)))
+        {
+            continue;
+        }
+
+        ++call_site.allocation_count;
+        call_site.allocation_size += size;
+        call_site.live_size += size;
+        return static_cast<uint16_t>(index);
+    }
+
+    return 0;
+}
+
+static void lv_slab_allocator_resize_call_site(
+    uint16_t index,
+    size_t old_size,
+    size_t new_size)
+{
+    if (!index)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(g_slab_allocator.call_site_mutex);
+    lv_slab_allocator_call_site_t& call_site =
+        g_slab_allocator.call_sites[index];
+    call_site.live_size -= old_size;
+    call_site.live_size += new_size;
+}
+
+static lv_slab_allocator_header_t* lv_slab_allocator_get_header(
+    void* p)
+{
+    lv_slab_allocator_header_t* header =
+        static_cast<lv_slab_allocator_header_t*>(p) - 1;
+#if LV_SLAB_ALLOCATOR_DEBUG
+    if (LV_SLAB_ALLOCATOR_FREED_MAGIC == header->magic)
+    {
+        LV_LOG_ERROR("Double free of %p", p);
+        return NULL;
+    }
+    if (LV_SLAB_ALLOCATOR_LIVE_MAGIC != header->magic)
+    {
+        LV_LOG_ERROR("Invalid free of %p, not allocated by lv_malloc", p);
+        return NULL;
+    }
+#endif
+    return header;
+}
+
+static void* lv_slab_allocator_alloc_large(
+    size_t size)
+{
+    lv_slab_allocator_header_t* header =
+        static_cast<lv_slab_allocator_header_t*>(
+            std::malloc(sizeof(lv_slab_allocator_header_t) + size));
+    if (!header)
+    {
+        return NULL;
+    }
+    header->size_class = LV_SLAB_ALLOCATOR_LARGE_CLASS;
+    header->call_site = 0;
+    header->magic = LV_SLAB_ALLOCATOR_LIVE_MAGIC;
+    header->size = size;
+
+    const size_t allocated_size = lv_slab_allocator_get_large_size(header);
+    g_slab_allocator.large_allocation_count.fetch_add(
+        1,
+        std::memory_order_relaxed);
+    lv_slab_allocator_update_peak(
+        g_slab_allocator.large_peak_live_count,
+        g_slab_allocator.large_live_count.fetch_add(
+            1,
+            std::memory_order_relaxed) + 1);
+    g_slab_allocator.large_live_size.fetch_add(
+        size,
+        std::memory_order_relaxed);
+    g_slab_allocator.large_allocated_size.fetch_add(
+        allocated_size,
+        std::memory_order_relaxed);
+    lv_slab_allocator_add_size(size, allocated_size);
+
+    return header + 1;
+}
+
+static void lv_slab_allocator_free_large(
+    lv_slab_allocator_header_t* header)
+{
+    const size_t size = static_cast<size_t>(header->size);
+    const size_t allocated_size = lv_slab_allocator_get_large_size(header);
+    g_slab_allocator.large_live_count.fetch_sub(
+        1,
+        std::memory_order_relaxed);
+    g_slab_allocator.large_live_size.fetch_sub(
+        size,
+        std::memory_order_relaxed);
+    g_slab_allocator.large_allocated_size.fetch_sub(
+        allocated_size,
+        std::memory_order_relaxed);
+    lv_slab_allocator_remove_size(size, allocated_size);
+
+    std::free(header);
+}
+
+static void* lv_slab_allocator_alloc_small(
+    size_t size)
+{
+    uint32_t index = g_slab_allocator_class_table[(size + 15) / 16];
+    lv_slab_allocator_class_t& size_class = g_slab_allocator.classes[index];
+    const size_t slot_size = sizeof(lv_slab_allocator_header_t)
+        + g_slab_allocator_block_sizes[index];
+
+    lv_slab_allocator_header_t* header = NULL;
+    {
+        std::lock_guard<std::mutex> lock(size_class.mutex);
+
+        if (size_class.free_list)
+        {
+            header = size_class.free_list;
+            std::memcpy(&size_class.free_list, header + 1, sizeof(void*));
+        }
+        else
+        {
+            if (!size_class.page_cursor ||
+                size_class.page_cursor + slot_size > size_class.page_end)
+            {
+                uint8_t* page = static_cast<uint8_t*>(
+                    std::malloc(LV_SLAB_ALLOCATOR_PAGE_SIZE));
+                if (!page)
+                {
+                    return NULL;
+                }
+                size_class.pages.push_back(page);
+                size_class.page_cursor = page;
+                size_class.page_end = page + LV_SLAB_ALLOCATOR_PAGE_SIZE;
+                ++size_class.stats.page_count;
+            }
+
+            header = reinterpret_cast<lv_slab_allocator_header_t*>(
+                size_class.page_cursor);
+            size_class.page_cursor += slot_size;
+        }
+
+        lv_slab_allocator_count_allocation(size_class.stats, size);
+    }
+
+    header->size_class = static_cast<uint16_t>(index);
+    header->call_site = 0;
+    header->magic = LV_SLAB_ALLOCATOR_LIVE_MAGIC;
+    header->size = size;
+    lv_slab_allocator_add_size(size, slot_size);
+
+    return header + 1;
+}
+
+static void lv_slab_allocator_free_small(
+    lv_slab_allocator_header_t* header)
+{
+    const size_t size = static_cast<size_t>(header->size);
+    const size_t block_size = g_slab_allocator_block_sizes[header->size_class];
+    lv_slab_allocator_remove_size(
+        size,
+        sizeof(lv_slab_allocator_header_t) + block_size);
+
+#if LV_SLAB_ALLOCATOR_DEBUG
+    std::memset(header + 1, LV_SLAB_ALLOCATOR_POISON, block_size);
+#endif
+
+    lv_slab_allocator_class_t& size_class =
+        g_slab_allocator.classes[header->size_class];
+    std::lock_guard<std::mutex> lock(size_class.mutex);
+    std::memcpy(header + 1, &size_class.free_list, sizeof(void*));
+    size_class.free_list = header;
+    --size_class.stats.live_count;
+    size_class.stats.live_size -= size;
+}
+
+void lv_mem_init(void)
+{
+    // The size classes are statically initialized.
+}
+
+void lv_mem_deinit(void)
+{
+#if LV_SLAB_ALLOCATOR_DEBUG
+    if (g_slab_allocator.requested_size.load(std::memory_order_relaxed))
+    {
+        std::printf("The live allocations of lv_mem_deinit:\n");
+        lv_slab_allocator_dump();
+    }
+#endif
+
+    // Only the pages without the live blocks are released, because the blocks
+    // leaked by the callers may still be used.
+    for (lv_slab_allocator_class_t& size_class : g_slab_allocator.classes)
+    {
+        std::lock_guard<std::mutex> lock(size_class.mutex);
+        if (size_class.stats.live_count)
+        {
+            continue;
+        }
+        for (void* page : size_class.pages)
+        {
+            std::free(page);
+        }
+        size_class.pages.clear();
+        size_class.free_list = NULL;
+        size_class.page_cursor = NULL;
+        size_class.page_end = NULL;
+        size_class.stats.page_count = 0;
+    }
+}
+
+lv_mem_pool_t lv_mem_add_pool(
+    void* mem,
+    size_t bytes)
+{
+    LV_UNUSED(mem);
+    LV_UNUSED(bytes);
+
+    // The pages are allocated from the C runtime on demand.
+    return NULL;
+}
+
+void lv_mem_remove_pool(
+    lv_mem_pool_t pool)
+{
+    LV_UNUSED(pool);
+}
+
+void* lv_malloc_core(
+    size_t size)
+{
+    void* p = (!LV_SLAB_ALLOCATOR_POOLS ||
+        size > LV_SLAB_ALLOCATOR_MAX_BLOCK_SIZE)
+        ? lv_slab_allocator_alloc_large(size)
+        : lv_slab_allocator_alloc_small(size);
+
+#if LV_SLAB_ALLOCATOR_SAMPLE_INTERVAL
+    static thread_local uint32_t sample_countdown = 0;
+    if (p && !sample_countdown--)
+    {
+        sample_countdown = LV_SLAB_ALLOCATOR_SAMPLE_INTERVAL - 1;
+        static_cast<lv_slab_allocator_header_t*>(p)[-1].call_site =
+            lv_slab_allocator_sample_call_site(size);
+    }
+#endif
+
+    lv_allocation_tracer_record_alloc(p, size);
+
+    return p;
+}
+
+void lv_free_core(
+    void* p)
+{
+    if (!p)
+    {
+        return;
+    }
+
+    lv_slab_allocator_header_t* header = lv_slab_allocator_get_header(p);
+    if (!header)
+    {
+        return;
+    }
+    header->magic = LV_SLAB_ALLOCATOR_FREED_MAGIC;
+
+    lv_allocation_tracer_record_free(p);
+    lv_slab_allocator_resize_call_site(
+        header->call_site,
+        static_cast<size_t>(header->size),
+        0);
+
+    if (LV_SLAB_ALLOCATOR_LARGE_CLASS == header->size_class)
+    {
+        lv_slab_allocator_free_large(header);
+    }
+    else
+    {
+        lv_slab_allocator_free_small(header);
+    }
+}
+
+void* lv_realloc_core(
+    void* p,
+    size_t new_size)
+{
+    if (!p)
+    {
+        return lv_malloc_core(new_size);
+    }
+
+    lv_slab_allocator_header_t* header = lv_slab_allocator_get_header(p);
+    if (!header)
+    {
+        return NULL;
+    }
+    const size_t old_size = static_cast<size_t>(header->size);
+
+    if (LV_SLAB_ALLOCATOR_LARGE_CLASS != header->size_class)
+    {
+        // Shrinking or growing within the block needn't move the data.
+        if (new_size <= g_slab_allocator_block_sizes[header->size_class])
+        {
+            {
+                lv_slab_allocator_class_t& size_class =
+                    g_slab_allocator.classes[header->size_class];
+                std::lock_guard<std::mutex> lock(size_class.mutex);
+                size_class.stats.live_size -= old_size;
+                size_class.stats.live_size += new_size;
+            }
+            lv_slab_allocator_remove_size(old_size, 0);
+            lv_slab_allocator_add_size(new_size, 0);
+            lv_slab_allocator_resize_call_site(
+                header->call_site,
+                old_size,
+                new_size);
+            header->size = new_size;
+            lv_allocation_tracer_record_free(p);
+            lv_allocation_tracer_record_alloc(p, new_size);
+            return p;
+        }
+    }
+    else if (!LV_SLAB_ALLOCATOR_POOLS ||
+        new_size > LV_SLAB_ALLOCATOR_MAX_BLOCK_SIZE)
+    {
+        // Let the C runtime grow or shrink the block in place if possible.
+        const size_t old_allocated_size =
+            lv_slab_allocator_get_large_size(header);
+        lv_slab_allocator_header_t* new_header =
+            static_cast<lv_slab_allocator_header_t*>(std::realloc(
+                header,
+                sizeof(lv_slab_allocator_header_t) + new_size));
+        if (!new_header)
+        {
+            return NULL;
+        }
+        new_header->size = new_size;
+
+        const size_t new_allocated_size =
+            lv_slab_allocator_get_large_size(new_header);
+        g_slab_allocator.large_live_size.fetch_add(
+            new_size - old_size,
+            std::memory_order_relaxed);
+        g_slab_allocator.large_allocated_size.fetch_add(
+            new_allocated_size - old_allocated_size,
+            std::memory_order_relaxed);
+        lv_slab_allocator_remove_size(old_size, old_allocated_size);
+        lv_slab_allocator_add_size(new_size, new_allocated_size);
+        lv_slab_allocator_resize_call_site(
+            new_header->call_site,
+            old_size,
+            new_size);
+        lv_allocation_tracer_record_free(p);
+        lv_allocation_tracer_record_alloc(new_header + 1, new_size);
+
+        return new_header + 1;
+    }
+
+    void* new_p = lv_malloc_core(new_size);
+    if (!new_p)
+    {
+        return NULL;
+    }
+    std::memcpy(new_p, p, LV_MIN(old_size, new_size));
+    lv_free_core(p);
+
+    return new_p;
+}
+
+void lv_mem_monitor_core(
+    lv_mem_monitor_t* mon_p)
+{
+    lv_slab_allocator_stats_t stats;
+    lv_slab_allocator_get_stats(&stats);
+
+    size_t free_count = 0;
+    size_t free_biggest_size = 0;
+    size_t used_count = stats.large.live_count;
+    for (const lv_slab_allocator_class_stats_t& class_stats : stats.classes)
+    {
+        const size_t block_count = class_stats.page_count
+            * (LV_SLAB_ALLOCATOR_PAGE_SIZE
+                / (sizeof(lv_slab_allocator_header_t)
+                    + class_stats.block_size));
+        used_count += class_stats.live_count;
+        free_count += block_count - class_stats.live_count;
+        if (block_count > class_stats.live_count)
+        {
+            free_biggest_size = class_stats.block_size;
+        }
+    }
+
+    // The free bytes are the free blocks of the slab pools, because the
+    // allocations forwarded to the C runtime have no free space.
+    const size_t used_size =
+        LV_MIN(stats.allocated_size, stats.reserved_size);
+
+    mon_p->total_size = stats.reserved_size;
+    mon_p->free_cnt = free_count;
+    mon_p->free_size = stats.reserved_size - used_size;
+    mon_p->free_biggest_size = free_biggest_size;
+    mon_p->used_cnt = used_count;
+    mon_p->max_used = stats.peak_allocated_size;
+    mon_p->used_pct = static_cast<uint8_t>(
+        stats.reserved_size ? used_size * 100 / stats.reserved_size : 0);
+    // Unlike the builtin allocator, the free blocks of a size class are
+    // interchangeable, so the fragmentation is estimated from the bytes wasted
+    // by the headers and the rounding instead.
+    mon_p->frag_pct = stats.fragmentation_percent;
+}
+
+lv_result_t lv_mem_test_core(void)
+{
+#if LV_SLAB_ALLOCATOR_DEBUG
+    for (lv_slab_allocator_class_t& size_class : g_slab_allocator.classes)
+    {
+        std::lock_guard<std::mutex> lock(size_class.mutex);
+        for (lv_slab_allocator_header_t* header = size_class.free_list;
+            header;
+            std::memcpy(&header, header + 1, sizeof(void*)))
+        {
+            if (LV_SLAB_ALLOCATOR_FREED_MAGIC != header->magic)
+            {
+                return LV_RESULT_INVALID;
+            }
+        }
+    }
+#endif
+
+    return LV_RESULT_OK;
+}
+
+#endif /* LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM */
+
+static void lv_slab_allocator_frame_reset()
+{
+    std::lock_guard<std::mutex> lock(g_slab_allocator.frame_mutex);
+
+    for (void* block : g_slab_allocator.frame_overflow_blocks)
+    {
+        std::free(block);
+    }
+    g_slab_allocator.frame_overflow_blocks.clear();
+
+    // Grow the frame buffer to the size of the last frame, so the next frame
+    // is usually served by the bump pointer only.
+    if (g_slab_allocator.frame_size > g_slab_allocator.frame_capacity)
+    {
+        uint8_t* frame_buffer = static_cast<uint8_t*>(
+            std::malloc(g_slab_allocator.frame_size));
+        if (frame_buffer)
+        {
+            std::free(g_slab_allocator.frame_buffer);
+            g_slab_allocator.frame_buffer = frame_buffer;
+            g_slab_allocator.frame_capacity = g_slab_allocator.frame_size;
+        }
+    }
+
+    g_slab_allocator.frame_used = 0;
+    g_slab_allocator.frame_size = 0;
+    ++g_slab_allocator.frame_reset_count;
+}
+
+static void lv_slab_allocator_display_event_callback(
+    lv_event_t* e)
+{
+    switch (lv_event_get_code(e))
+    {
+    case LV_EVENT_REFR_READY:
+        lv_slab_allocator_frame_reset();
+        break;
+    case LV_EVENT_DELETE:
+    {
+        std::lock_guard<std::mutex> lock(g_slab_allocator.frame_mutex);
+        --g_slab_allocator.attached_display_count;
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void* lv_slab_allocator_frame_alloc(
+    size_t size)
+{
+    size = (LV_MAX(size, 1) + 15) & ~static_cast<size_t>(15);
+
+    std::lock_guard<std::mutex> lock(g_slab_allocator.frame_mutex);
+
+    if (!g_slab_allocator.attached_display_count)
+    {
+        return NULL;
+    }
+
+    if (!g_slab_allocator.frame_buffer)
+    {
+        g_slab_allocator.frame_buffer = static_cast<uint8_t*>(
+            std::malloc(LV_SLAB_ALLOCATOR_FRAME_ARENA_SIZE));
+        if (!g_slab_allocator.frame_buffer)
+        {
+            return NULL;
+        }
+        g_slab_allocator.frame_capacity = LV_SLAB_ALLOCATOR_FRAME_ARENA_SIZE;
+    }
+
+    void* block = NULL;
+    if (g_slab_allocator.frame_used + size <= g_slab_allocator.frame_capacity)
+    {
+        block = g_slab_allocator.frame_buffer + g_slab_allocator.frame_used;
+        g_slab_allocator.frame_used += size;
+    }
+    else
+    {
+        block = std::malloc(size);
+        if (!block)
+        {
+            return NULL;
+        }
+        g_slab_allocator.frame_overflow_blocks.push_back(block);
+    }
+
+    g_slab_allocator.frame_size += size;
+    if (g_slab_allocator.frame_peak_size < g_slab_allocator.frame_size)
+    {
+        g_slab_allocator.frame_peak_size = g_slab_allocator.frame_size;
+    }
+
+    return block;
+}
+
+bool lv_slab_allocator_attach_display(
+    lv_display_t* display)
+{
+    if (!display)
+    {
+        return false;
+    }
+
+    lv_display_add_event_cb(
+        display,
+        lv_slab_allocator_display_event_callback,
+        LV_EVENT_REFR_READY,
+        NULL);
+    lv_display_add_event_cb(
+        display,
+        lv_slab_allocator_display_event_callback,
+        LV_EVENT_DELETE,
+        NULL);
+
+    std::lock_guard<std::mutex> lock(g_slab_allocator.frame_mutex);
+    ++g_slab_allocator.attached_display_count;
+
+    return true;
+}
+
+bool lv_slab_allocator_get_stats(
+    lv_slab_allocator_stats_t* stats)
+{
+    if (!stats)
+    {
+        return false;
+    }
+
+    size_t reserved_size = 0;
+    for (size_t i = 0; i < LV_SLAB_ALLOCATOR_CLASS_COUNT; ++i)
+    {
+        lv_slab_allocator_class_t& size_class = g_slab_allocator.classes[i];
+        std::lock_guard<std::mutex> lock(size_class.mutex);
+        stats->classes[i] = size_class.stats;
+        stats->classes[i].block_size = g_slab_allocator_block_sizes[i];
+        reserved_size +=
+            size_class.stats.page_count * LV_SLAB_ALLOCATOR_PAGE_SIZE;
+    }
+
+    std::memset(&stats->large, 0, sizeof(stats->large));
+    stats->large.live_count = g_slab_allocator.large_live_count.load(
+        std::memory_order_relaxed);
+    stats->large.peak_live_count =
+        g_slab_allocator.large_peak_live_count.load(std::memory_order_relaxed);
+    stats->large.live_size = g_slab_allocator.large_live_size.load(
+        std::memory_order_relaxed);
+    stats->large.allocation_count =
+        g_slab_allocator.large_allocation_count.load(
+            std::memory_order_relaxed);
+    reserved_size += g_slab_allocator.large_allocated_size.load(
+        std::memory_order_relaxed);
+
+    stats->requested_size = g_slab_allocator.requested_size.load(
+        std::memory_order_relaxed);
+    stats->allocated_size = g_slab_allocator.allocated_size.load(
+        std::memory_order_relaxed);
+    stats->peak_allocated_size = g_slab_allocator.peak_allocated_size.load(
+        std::memory_order_relaxed);
+    stats->reserved_size = reserved_size;
+    stats->fragmentation_percent = static_cast<uint8_t>(
+        stats->allocated_size > stats->requested_size
+            ? (stats->allocated_size - stats->requested_size) * 100
+                / stats->allocated_size
+            : 0);
+
+    std::lock_guard<std::mutex> lock(g_slab_allocator.frame_mutex);
+    stats->frame_arena_size = g_slab_allocator.frame_capacity;
+    stats->frame_arena_peak_size = g_slab_allocator.frame_peak_size;
+    stats->frame_arena_reset_count = g_slab_allocator.frame_reset_count;
+
+    return true;
+}
+
+uint32_t lv_slab_allocator_get_call_sites(
+    lv_slab_allocator_call_site_stats_t* stats,
+    uint32_t max_count)
+{
+    if (!stats || !max_count)
+    {
+        return 0;
+    }
+
+    std::vector<lv_slab_allocator_call_site_stats_t> call_sites;
+    {
+        std::lock_guard<std::mutex> lock(g_slab_allocator.call_site_mutex);
+        for (const lv_slab_allocator_call_site_t& call_site :
+            g_slab_allocator.call_sites)
+        {
+            if (!call_site.allocation_count)
+            {
+                continue;
+            }
+
+            lv_slab_allocator_call_site_stats_t call_site_stats;
+            std::memcpy(
+                call_site_stats.frames,
+                call_site.frames,
+                sizeof(call_site_stats.frames));
+            call_site_stats.allocation_count = call_site.allocation_count
+                * LV_SLAB_ALLOCATOR_SAMPLE_INTERVAL;
+            call_site_stats.allocation_size = call_site.allocation_size
+                * LV_SLAB_ALLOCATOR_SAMPLE_INTERVAL;
+            call_site_stats.live_size = call_site.live_size
+                * LV_SLAB_ALLOCATOR_SAMPLE_INTERVAL;
+            call_sites.push_back(call_site_stats);
+        }
+    }
+
+    uint32_t count = static_cast<uint32_t>(
+        LV_MIN(call_sites.size(), static_cast<size_t>(max_count)));
+    std::partial_sort(
+        call_sites.begin(),
+        call_sites.begin() + count,
+        call_sites.end(),
+        [](
+            const lv_slab_allocator_call_site_stats_t& left,
+            const lv_slab_allocator_call_site_stats_t& right)
+    {
+        return left.allocation_size > right.allocation_size;
+    });
+    std::copy(call_sites.begin(), call_sites.begin() + count, stats);
+
+    return count;
+}
+
+void lv_slab_allocator_dump(void)
+{
+    lv_slab_allocator_stats_t stats;
+    if (!lv_slab_allocator_get_stats(&stats))
+    {
+        return;
+    }
+
+    std::printf(
+        "%-10s %8s %10s %10s %12s %14s\n",
+        "class",
+        "pages",
+        "live",
+        "peak_live",
+        "live_bytes",
+        "allocations");
+
+    for (size_t i = 0; i <= LV_SLAB_ALLOCATOR_CLASS_COUNT; ++i)
+    {
+        const lv_slab_allocator_class_stats_t& class_stats =
+            i < LV_SLAB_ALLOCATOR_CLASS_COUNT ? stats.classes[i] : stats.large;
+
+        char name[24];
+        if (class_stats.block_size)
+        {
+            std::snprintf(name, sizeof(name), "%zu", class_stats.block_size);
+        }
+        else
+        {
+            std::snprintf(name, sizeof(name), "large");
+        }
+
+        std::printf(
+            "%-10s %8zu %10zu %10zu %12zu %14llu\n",
+            name,
+            class_stats.page_count,
+            class_stats.live_count,
+            class_stats.peak_live_count,
+            class_stats.live_size,
+            static_cast<unsigned long long>(class_stats.allocation_count));
+    }
+
+    std::printf(
+        "Requested %zu bytes, allocated %zu bytes (peak %zu bytes), "
+        "reserved %zu bytes, %u%% fragmentation\n",
+        stats.requested_size,
+        stats.allocated_size,
+        stats.peak_allocated_size,
+        stats.reserved_size,
+        stats.fragmentation_percent);
+    std::printf(
+        "Frame arena: %zu bytes, peak %zu bytes per frame, %llu frames\n",
+        stats.frame_arena_size,
+        stats.frame_arena_peak_size,
+        static_cast<unsigned long long>(stats.frame_arena_reset_count));
+
+    lv_slab_allocator_call_site_stats_t call_sites[16];
+    uint32_t call_site_count = lv_slab_allocator_get_call_sites(
+        call_sites,
+        sizeof(call_sites) / sizeof(*call_sites));
+    if (!call_site_count)
+    {
+        return;
+    }
+
+    std::printf(
+        "\nTop call sites, estimated from 1 in %u allocations:\n",
+        LV_SLAB_ALLOCATOR_SAMPLE_INTERVAL);
+    std::printf(
+        "%14s %14s %12s  %s\n",
+        "allocations",
+        "bytes",
+        "live_bytes",
+        "frames");
+    for (uint32_t i = 0; i < call_site_count; ++i)
+    {
+        const lv_slab_allocator_call_site_stats_t& call_site = call_sites[i];
+        std::printf(
+            "%14llu %14llu %12zu ",
+            static_cast<unsigned long long>(call_site.allocation_count),
+            static_cast<unsigned long long>(call_site.allocation_size),
+            call_site.live_size);
+
+#ifdef __GLIBC__
+        // Resolve the symbols when available, which needs -rdynamic.
+        char** symbols = ::backtrace_symbols(
+            const_cast<void* const*>(call_site.frames),
+            LV_SLAB_ALLOCATOR_CALL_SITE_DEPTH);
+#else
+        char** symbols = NULL;
+#endif
+        for (size_t j = 0; j < LV_SLAB_ALLOCATOR_CALL_SITE_DEPTH; ++j)
+        {
+            if (symbols)
+            {
+                std::printf(" %s", symbols[j]);
+            }
+            else
+            {
+                std::printf(" %p", call_site.frames[j]);
+            }
+        }
+        std::printf("\n");
+        std::free(symbols);
+    }
+}
+
+void lv_slab_allocator_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_slab_allocator_stats_t stats;
+    if (!buffer || !buffer_size || !lv_slab_allocator_get_stats(&stats))
+    {
+        return;
+    }
+
+    size_t live_count = stats.large.live_count;
+    uint64_t allocation_count = stats.large.allocation_count;
+    for (const lv_slab_allocator_class_stats_t& class_stats : stats.classes)
+    {
+        live_count += class_stats.live_count;
+        allocation_count += class_stats.allocation_count;
+    }
+
+    std::snprintf(
+        buffer,
+        buffer_size,
+        "%zu KiB used, peak %zu KiB, %u%% frag, %zu live, %llu allocs, "
+        "frame arena %zu/%zu KiB",
+        stats.allocated_size / 1024,
+        stats.peak_allocated_size / 1024,
+        stats.fragmentation_percent,
+        live_count,
+        static_cast<unsigned long long>(allocation_count),
+        stats.frame_arena_peak_size / 1024,
+        stats.frame_arena_size / 1024);
+}
@@ -0,0 +1,200 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglSlabAllocator.h
+ * PURPOSE:   Definition for the slab pool and frame arena allocator of LVGL
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#ifndef LVGL_SLAB_ALLOCATOR_H
+#define LVGL_SLAB_ALLOCATOR_H
+
+#include "lvgl/lvgl.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The number of the size classes of the slab pools. The block sizes
+ *        are from 16 to 2048 bytes, and the larger allocations are forwarded
+ *        to the C runtime.
+ */
+#define LV_SLAB_ALLOCATOR_CLASS_COUNT 14
+
+/**
+ * @brief The size in bytes of the pages carved into the blocks of a size
+ *        class.
+ */
+#ifndef LV_SLAB_ALLOCATOR_PAGE_SIZE
+#define LV_SLAB_ALLOCATOR_PAGE_SIZE (64 * 1024)
+#endif
+
+/**
+ * @brief The initial size in bytes of the frame arena, which grows to the
+ *        peak usage of a single frame.
+ */
+#ifndef LV_SLAB_ALLOCATOR_FRAME_ARENA_SIZE
+#define LV_SLAB_ALLOCATOR_FRAME_ARENA_SIZE (16 * 1024)
+#endif
+
+/**
+ * @brief Whether to serve the small allocations from the slab pools. If 0,
+ *        every allocation is forwarded to the C runtime like LV_STDLIB_CLIB,
+ *        and the allocator only counts them, which is cheap enough for the
+ *        release builds and makes lv_mem_monitor work without the builtin
+ *        allocator.
+ */
+#ifndef LV_SLAB_ALLOCATOR_POOLS
+#define LV_SLAB_ALLOCATOR_POOLS 1
+#endif
+
+/**
+ * @brief Every Nth allocation of a thread records its call site, which is used
+ *        for estimating the allocated bytes per call site. 0 means the call
+ *        sites are not recorded.
+ */
+#ifndef LV_SLAB_ALLOCATOR_SAMPLE_INTERVAL
+#define LV_SLAB_ALLOCATOR_SAMPLE_INTERVAL 64
+#endif
+
+/**
+ * @brief The maximum number of the distinct call sites. The allocations from
+ *        the other call sites are not sampled when the table is full.
+ */
+#define LV_SLAB_ALLOCATOR_MAX_CALL_SITES 1024
+
+/**
+ * @brief The number of the return addresses recorded for every call site,
+ *        starting from the LVGL allocation function called, so the actual
+ *        caller is included even if the compiler inlines some of them.
+ */
+#define LV_SLAB_ALLOCATOR_CALL_SITE_DEPTH 4
+
+/**
+ * @brief Whether to enable the debug mode, which poisons the freed blocks and
+ *        detects the invalid and double frees. The live allocations are
+ *        reported by lv_mem_deinit.
+ */
+#ifndef LV_SLAB_ALLOCATOR_DEBUG
+#define LV_SLAB_ALLOCATOR_DEBUG 0
+#endif
+
+typedef struct _lv_slab_allocator_class_stats_t
+{
+    // 0 means the allocations forwarded to the C runtime.
+    size_t block_size;
+    size_t page_count;
+    size_t live_count;
+    size_t peak_live_count;
+    // The requested bytes of the live allocations.
+    size_t live_size;
+    uint64_t allocation_count;
+} lv_slab_allocator_class_stats_t;
+
+typedef struct _lv_slab_allocator_stats_t
+{
+    lv_slab_allocator_class_stats_t classes[LV_SLAB_ALLOCATOR_CLASS_COUNT];
+    lv_slab_allocator_class_stats_t large;
+    // The requested bytes of all live allocations.
+    size_t requested_size;
+    // The bytes taken by all live allocations, including the headers and the
+    // rounding of the size classes or the C runtime.
+    size_t allocated_size;
+    size_t peak_allocated_size;
+    // The bytes of the slab pages and the live allocations forwarded to the C
+    // runtime.
+    size_t reserved_size;
+    // The share of the allocated bytes wasted by the headers and the rounding.
+    uint8_t fragmentation_percent;
+    size_t frame_arena_size;
+    size_t frame_arena_peak_size;
+    uint64_t frame_arena_reset_count;
+} lv_slab_allocator_stats_t;
+
+typedef struct _lv_slab_allocator_call_site_stats_t
+{
+    void* frames[LV_SLAB_ALLOCATOR_CALL_SITE_DEPTH];
+    // The estimates from the sampled allocations.
+    uint64_t allocation_count;
+    uint64_t allocation_size;
+    size_t live_size;
+} lv_slab_allocator_call_site_stats_t;
+
+/**
+ * @brief Allocates a block from the frame arena, which is released as a whole
+ *        when the current frame of an attached display is finished, so the
+ *        transient allocations of the draw units needn't be freed.
+ * @param size The size in bytes of the block.
+ * @return The 16-byte aligned block, or NULL if no display is attached or the
+ *         allocation failed. The callers should fall back to lv_malloc when
+ *         NULL is returned.
+ * @remark This function can be called from the draw threads. The blocks must
+ *         not be used after LV_EVENT_REFR_READY of the display being rendered.
+ */
+void* lv_slab_allocator_frame_alloc(
+    size_t size);
+
+/**
+ * @brief Releases the frame arena when every frame of the display is
+ *        finished, which enables lv_slab_allocator_frame_alloc.
+ * @param display The display.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark The displays are rendered one after another by LVGL, so all displays
+ *         rendered with the parallel draw unit should be attached.
+ */
+bool lv_slab_allocator_attach_display(
+    lv_display_t* display);
+
+/**
+ * @brief Gets the statistics of the slab pools and the frame arena.
+ * @param stats The statistics of the slab pools and the frame arena.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark The allocations of LVGL are only counted if LV_USE_STDLIB_MALLOC
+ *         is set to LV_STDLIB_CUSTOM. Otherwise, only the frame arena is
+ *         available and the other statistics are zero.
+ */
+bool lv_slab_allocator_get_stats(
+    lv_slab_allocator_stats_t* stats);
+
+/**
+ * @brief Gets the estimated statistics of the call sites which allocate the
+ *        most bytes, sorted by the allocated bytes in descending order.
+ * @param stats The array which receives the statistics of the call sites.
+ * @param max_count The number of the elements of the array.
+ * @return The number of the call sites written to the array.
+ * @remark The statistics are estimated from every
+ *         LV_SLAB_ALLOCATOR_SAMPLE_INTERVAL-th allocation of every thread.
+ */
+uint32_t lv_slab_allocator_get_call_sites(
+    lv_slab_allocator_call_site_stats_t* stats,
+    uint32_t max_count);
+
+/**
+ * @brief Prints the statistics of every size class and the call sites which
+ *        allocate the most bytes to the standard output as tables.
+ */
+void lv_slab_allocator_dump(void);
+
+/**
+ * @brief Formats the statistics of the slab pools and the frame arena as a
+ *        single line of text, which can be used as the callback of
+ *        lv_stats_monitor_add_source.
+ * @param buffer The buffer which receives the formatted statistics.
+ * @param buffer_size The size of the buffer in bytes.
+ * @param user_data Unused.
+ */
+void lv_slab_allocator_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !LVGL_SLAB_ALLOCATOR_H */
@@ -0,0 +1,150 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglStatsMonitor.cpp
+ * PURPOSE:   Implementation for the LVGL platform statistics monitor
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglStatsMonitor.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+typedef struct _lv_stats_monitor_source_t
+{
+    const char* name;
+    lv_stats_monitor_format_cb_t format_cb;
+    void* user_data;
+} lv_stats_monitor_source_t;
+
+static struct
+{
+    lv_stats_monitor_source_t sources[LV_STATS_MONITOR_MAX_SOURCES];
+    size_t source_count;
+} g_stats_monitor;
+
+static std::string lv_stats_monitor_format()
+{
+    std::string result;
+
+    for (size_t i = 0; i < g_stats_monitor.source_count; ++i)
+    {
+        const lv_stats_monitor_source_t& source = g_stats_monitor.sources[i];
+
+        char buffer[256];
+        buffer[0] = '\0';
+        source.format_cb(buffer, sizeof(buffer), source.user_data);
+
+        if (!result.empty())
+        {
+            result += '\n';
+        }
+        result += source.name;
+        result += ": ";
+        result += buffer;
+    }
+
+    return result;
+}
+
+static void lv_stats_monitor_timer_callback(
+    lv_timer_t* timer)
+{
+    lv_obj_t* label = static_cast<lv_obj_t*>(lv_timer_get_user_data(timer));
+    lv_label_set_text(label, lv_stats_monitor_format().c_str());
+}
+
+static void lv_stats_monitor_label_delete_event_callback(
+    lv_event_t* e)
+{
+    lv_timer_delete(static_cast<lv_timer_t*>(lv_event_get_user_data(e)));
+}
+
+bool lv_stats_monitor_add_source(
+    const char* name,
+    lv_stats_monitor_format_cb_t format_cb,
+    void* user_data)
+{
+    if (!name || !format_cb)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < g_stats_monitor.source_count; ++i)
+    {
+        lv_stats_monitor_source_t& source = g_stats_monitor.sources[i];
+        if (0 == std::strcmp(source.name, name))
+        {
+            source.format_cb = format_cb;
+            source.user_data = user_data;
+            return true;
+        }
+    }
+
+    if (g_stats_monitor.source_count >= LV_STATS_MONITOR_MAX_SOURCES)
+    {
+        return false;
+    }
+
+    lv_stats_monitor_source_t& source =
+        g_stats_monitor.sources[g_stats_monitor.source_count++];
+    source.name = name;
+    source.format_cb = format_cb;
+    source.user_data = user_data;
+
+    return true;
+}
+
+lv_obj_t* lv_stats_monitor_show(
+    lv_display_t* display,
+    uint32_t period)
+{
+    if (!display)
+    {
+        return NULL;
+    }
+
+    lv_obj_t* label = lv_label_create(lv_display_get_layer_sys(display));
+    if (!label)
+    {
+        return NULL;
+    }
+
+    lv_obj_set_style_bg_opa(label, LV_OPA_50, 0);
+    lv_obj_set_style_bg_color(label, lv_color_black(), 0);
+    lv_obj_set_style_text_color(label, lv_color_white(), 0);
+    lv_obj_set_style_pad_all(label, 3, 0);
+    lv_obj_align(label, LV_ALIGN_TOP_RIGHT, 0, 0);
+    lv_label_set_text(label, lv_stats_monitor_format().c_str());
+
+    lv_timer_t* timer = lv_timer_create(
+        lv_stats_monitor_timer_callback,
+        LV_MAX(period, 1U),
+        label);
+    if (!timer)
+    {
+        lv_obj_delete(label);
+        return NULL;
+    }
+
+    lv_obj_add_event_cb(
+        label,
+        lv_stats_monitor_label_delete_event_callback,
+        LV_EVENT_DELETE,
+        timer);
+
+    return label;
+}
+
+void lv_stats_monitor_print(void)
+{
+    std::string text = lv_stats_monitor_format();
+    if (!text.empty())
+    {
+        std::printf("%s\n", text.c_str());
+    }
+}
@@ -0,0 +1,78 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglStatsMonitor.h
+ * PURPOSE:   Definition for the LVGL platform statistics monitor
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#ifndef LVGL_STATS_MONITOR_H
+#define LVGL_STATS_MONITOR_H
+
+#include "lvgl/lvgl.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The maximum number of statistics sources.
+ */
+#define LV_STATS_MONITOR_MAX_SOURCES 16
+
+/**
+ * @brief The callback which formats the current statistics of a source.
+ * @param buffer The buffer which receives the formatted statistics as a
+ *               single line of text.
+ * @param buffer_size The size of the buffer in bytes.
+ * @param user_data The user data passed to lv_stats_monitor_add_source.
+ */
+typedef void (*lv_stats_monitor_format_cb_t)(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data);
+
+/**
+ * @brief Adds a statistics source, e.g. the counters of a cache.
+ * @param name The name of the source, which must be a string literal or
+ *             outlive the statistics monitor.
+ * @param format_cb The callback which formats the current statistics.
+ * @param user_data The user data passed to the callback.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark Adding a source with an existing name replaces the callback and the
+ *         user data of the existing source.
+ */
+bool lv_stats_monitor_add_source(
+    const char* name,
+    lv_stats_monitor_format_cb_t format_cb,
+    void* user_data);
+
+/**
+ * @brief Shows the statistics of all sources in a label on the system layer of
+ *        the display, which complements the performance and memory monitors
+ *        of the LVGL sysmon.
+ * @param display The display which shows the statistics.
+ * @param period The refresh period of the statistics in milliseconds.
+ * @return If succeed, return the label. Otherwise, return NULL.
+ * @remark The label is aligned to the top right corner of the display because
+ *         the bottom corners are used by the sysmon.
+ */
+lv_obj_t* lv_stats_monitor_show(
+    lv_display_t* display,
+    uint32_t period);
+
+/**
+ * @brief Prints the statistics of all sources to the standard output, one line
+ *        for each source.
+ */
+void lv_stats_monitor_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !LVGL_STATS_MONITOR_H */
@@ -0,0 +1,248 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglStyleCache.cpp
+ * PURPOSE:   Implementation for the per-object resolved style property cache
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#include "LvglStyleCache.h"
+
+#include "lvgl/src/lvgl_private.h"
+
+#include <cstdio>
+#include <unordered_map>
+#include <vector>
+
+typedef struct _lv_style_cache_entry_t
+{
+    lv_part_t part;
+    lv_style_prop_t prop;
+    lv_style_value_t value;
+} lv_style_cache_entry_t;
+
+static struct
+{
+    // The objects which have the event callbacks for the invalidation, with
+    // their cached values, which are usually only a few hot properties.
+    std::unordered_map<lv_obj_t*, std::vector<lv_style_cache_entry_t>> objects;
+    uint64_t hit_count;
+    uint64_t miss_count;
+    uint64_t bypass_count;
+    uint64_t style_invalidation_count;
+    uint64_t state_invalidation_count;
+    uint64_t theme_invalidation_count;
+} g_style_cache;
+
+static void lv_style_cache_invalidate_tree(
+    lv_obj_t* obj)
+{
+    auto iterator = g_style_cache.objects.find(obj);
+    if (iterator != g_style_cache.objects.end())
+    {
+        iterator->second.clear();
+    }
+
+    uint32_t child_count = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < child_count; ++i)
+    {
+        lv_style_cache_invalidate_tree(
+            lv_obj_get_child(obj, static_cast<int32_t>(i)));
+    }
+}
+
+static void lv_style_cache_event_callback(
+    lv_event_t* e)
+{
+    lv_obj_t* obj = static_cast<lv_obj_t*>(lv_event_get_current_target(e));
+
+    switch (lv_event_get_code(e))
+    {
+    case LV_EVENT_STYLE_CHANGED:
+    {
+        auto iterator = g_style_cache.objects.find(obj);
+        if (iterator != g_style_cache.objects.end())
+        {
+            iterator->second.clear();
+        }
+        ++g_style_cache.style_invalidation_count;
+        break;
+    }
+    case LV_EVENT_STATE_CHANGED:
+        // LVGL only refreshes the styles of the children when the state change
+        // affects the layout, so the inherited values are invalidated here.
+        lv_style_cache_invalidate_tree(obj);
+        ++g_style_cache.state_invalidation_count;
+        break;
+    case LV_EVENT_DELETE:
+        g_style_cache.objects.erase(obj);
+        break;
+    default:
+        break;
+    }
+}
+
+static bool lv_style_cache_has_transition(
+    const lv_obj_t* obj)
+{
+    for (uint32_t i = 0; i < obj->style_cnt; ++i)
+    {
+        if (obj->styles[i].is_trans)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+lv_style_value_t lv_style_cache_get_prop(
+    lv_obj_t* obj,
+    lv_part_t part,
+    lv_style_prop_t prop)
+{
+    if (lv_style_cache_has_transition(obj))
+    {
+        ++g_style_cache.bypass_count;
+        return lv_obj_get_style_prop(obj, part, prop);
+    }
+
+    auto iterator = g_style_cache.objects.find(obj);
+    if (iterator == g_style_cache.objects.end())
+    {
+        lv_obj_add_event_cb(
+            obj,
+            lv_style_cache_event_callback,
+            LV_EVENT_STYLE_CHANGED,
+            NULL);
+        lv_obj_add_event_cb(
+            obj,
+            lv_style_cache_event_callback,
+            LV_EVENT_STATE_CHANGED,
+            NULL);
+        lv_obj_add_event_cb(
+            obj,
+            lv_style_cache_event_callback,
+            LV_EVENT_DELETE,
+            NULL);
+        iterator = g_style_cache.objects.emplace(
+            obj,
+            std::vector<lv_style_cache_entry_t>()).first;
+    }
+
+    std::vector<lv_style_cache_entry_t>& entries = iterator->second;
+    for (const lv_style_cache_entry_t& entry : entries)
+    {
+        if (entry.prop == prop && entry.part == part)
+        {
+            ++g_style_cache.hit_count;
+            return entry.value;
+        }
+    }
+
+    ++g_style_cache.miss_count;
+
+    lv_style_cache_entry_t entry;
+    entry.part = part;
+    entry.prop = prop;
+    entry.value = lv_obj_get_style_prop(obj, part, prop);
+    entries.push_back(entry);
+
+    return entry.value;
+}
+
+void lv_style_cache_clear(void)
+{
+    // Keep the objects, because their event callbacks are still registered.
+    for (auto& object : g_style_cache.objects)
+    {
+        object.second.clear();
+    }
+}
+
+bool lv_style_cache_set_theme(
+    lv_display_t* display,
+    lv_theme_t* theme)
+{
+    if (!theme)
+    {
+        return false;
+    }
+
+    if (!display)
+    {
+        display = lv_display_get_default();
+        if (!display)
+        {
+            return false;
+        }
+    }
+
+    lv_display_set_theme(display, theme);
+
+    lv_style_cache_clear();
+    ++g_style_cache.theme_invalidation_count;
+
+    return true;
+}
+
+bool lv_style_cache_get_stats(
+    lv_style_cache_stats_t* stats)
+{
+    if (!stats)
+    {
+        return false;
+    }
+
+    size_t entry_count = 0;
+    for (const auto& object : g_style_cache.objects)
+    {
+        entry_count += object.second.size();
+    }
+
+    stats->object_count =
+        static_cast<uint32_t>(g_style_cache.objects.size());
+    stats->entry_count = static_cast<uint32_t>(entry_count);
+    stats->hit_count = g_style_cache.hit_count;
+    stats->miss_count = g_style_cache.miss_count;
+    stats->bypass_count = g_style_cache.bypass_count;
+    stats->style_invalidation_count = g_style_cache.style_invalidation_count;
+    stats->state_invalidation_count = g_style_cache.state_invalidation_count;
+    stats->theme_invalidation_count = g_style_cache.theme_invalidation_count;
+
+    return true;
+}
+
+void lv_style_cache_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_style_cache_stats_t stats;
+    if (!buffer || !buffer_size || !lv_style_cache_get_stats(&stats))
+    {
+        return;
+    }
+
+    uint64_t lookup_count = stats.hit_count + stats.miss_count;
+    std::snprintf(
+        buffer,
+        buffer_size,
+        "%u objects, %u values, %llu hits (%u%%), %llu misses, "
+        "%llu bypasses, %llu style, %llu state and %llu theme invalidations",
+        stats.object_count,
+        stats.entry_count,
+        static_cast<unsigned long long>(stats.hit_count),
+        lookup_count
+            ? static_cast<uint32_t>(stats.hit_count * 100 / lookup_count)
+            : 0,
+        static_cast<unsigned long long>(stats.miss_count),
+        static_cast<unsigned long long>(stats.bypass_count),
+        static_cast<unsigned long long>(stats.style_invalidation_count),
+        static_cast<unsigned long long>(stats.state_invalidation_count),
+        static_cast<unsigned long long>(stats.theme_invalidation_count));
+}
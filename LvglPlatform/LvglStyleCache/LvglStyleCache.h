@@ -0,0 +1,108 @@
+﻿/*
+ * PROJECT:   LVGL Platform for Windows
+ * FILE:      LvglStyleCache.h
+ * PURPOSE:   Definition for the per-object resolved style property cache
+ *
+ * LICENSE:   The MIT License
+ *
+ * MAINTAINER: MouriNaruto (Kenji.Mouri@outlook.com)
+ */
+
+#ifndef LVGL_STYLE_CACHE_H
+#define LVGL_STYLE_CACHE_H
+
+#include "lvgl/lvgl.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct _lv_style_cache_stats_t
+{
+    uint32_t object_count;
+    uint32_t entry_count;
+    uint64_t hit_count;
+    uint64_t miss_count;
+    // The lookups on the objects with running style transitions, which are
+    // not cached because the transitions change the values in every frame.
+    uint64_t bypass_count;
+    uint64_t style_invalidation_count;
+    uint64_t state_invalidation_count;
+    uint64_t theme_invalidation_count;
+} lv_style_cache_stats_t;
+
+/**
+ * @brief Gets a style property of an object from the resolved property cache,
+ *        which resolves the property with lv_obj_get_style_prop on the first
+ *        lookup and keeps the resolved value until the styles or the state of
+ *        the object change.
+ * @param obj The object.
+ * @param part The part of the object, e.g. LV_PART_MAIN.
+ * @param prop The style property, e.g. LV_STYLE_BG_COLOR.
+ * @return The resolved value of the style property.
+ * @remark The cached values of an object are invalidated by its
+ *         LV_EVENT_STYLE_CHANGED event, which LVGL also sends to the children
+ *         when an inherited property changes, and by its LV_EVENT_STATE_CHANGED
+ *         event, which also invalidates the cached values of the descendants
+ *         because they may inherit the properties depending on the state. The
+ *         theme changes made via lv_style_cache_set_theme invalidate the
+ *         cached values of all objects. The cache is dropped by
+ *         LV_EVENT_DELETE. Like the other LVGL object
+ *         functions, this function should only be called from the thread
+ *         running lv_timer_handler.
+ */
+lv_style_value_t lv_style_cache_get_prop(
+    lv_obj_t* obj,
+    lv_part_t part,
+    lv_style_prop_t prop);
+
+/**
+ * @brief Drops the cached values of all objects.
+ */
+void lv_style_cache_clear(void);
+
+/**
+ * @brief Sets the theme of a display via lv_display_set_theme, and drops the
+ *        cached values of all objects, because the values resolved from the
+ *        styles of the previous theme are no longer valid.
+ * @param display The display. NULL means the default display.
+ * @param theme The new theme.
+ * @return If succeed, return true. Otherwise, return false.
+ * @remark Use this function instead of lv_display_set_theme when the resolved
+ *         property cache is used. A theme initialized again in place, e.g. by
+ *         lv_theme_default_init with other colors, reports the change to all
+ *         objects via LV_EVENT_STYLE_CHANGED, which is handled as a style
+ *         change.
+ */
+bool lv_style_cache_set_theme(
+    lv_display_t* display,
+    lv_theme_t* theme);
+
+/**
+ * @brief Gets the statistics of the resolved style property cache.
+ * @param stats The statistics of the resolved style property cache.
+ * @return If succeed, return true. Otherwise, return false.
+ */
+bool lv_style_cache_get_stats(
+    lv_style_cache_stats_t* stats);
+
+/**
+ * @brief Formats the statistics of the resolved style property cache as a
+ *        single line of text, which can be used as the callback of
+ *        lv_stats_monitor_add_source.
+ * @param buffer The buffer which receives the formatted statistics.
+ * @param buffer_size The size of the buffer in bytes.
+ * @param user_data Unused.
+ */
+void lv_style_cache_format_stats(
+    char* buffer,
+    size_t buffer_size,
+    void* user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !LVGL_STYLE_CACHE_H */
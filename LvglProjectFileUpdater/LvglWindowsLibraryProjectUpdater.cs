@@ -232,6 +232,14 @@ namespace LvglProjectFileUpdater
             ProjectRoot.Save(Encoding.UTF8);
 
             FiltersRoot.Save(Encoding.UTF8);
+
+            Utilities.GenerateCMakeSourceList(
+                string.Format(
+                    @"{0}\LvglWindowsStatic.cmake",
+                    Path.GetFullPath(
+                        RepositoryRoot + @"\LvglWindows\")),
+                "LVGL_WINDOWS_STATIC_SOURCES",
+                NewSourceNames);
         }
     }
 }
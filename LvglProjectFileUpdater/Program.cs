@@ -231,6 +231,14 @@ namespace LvglProjectFileUpdater
             ProjectRoot.Save(Encoding.UTF8);
 
             FiltersRoot.Save(Encoding.UTF8);
+
+            Utilities.GenerateCMakeSourceList(
+                string.Format(
+                    @"{0}\LvglWindowsSimulator.cmake",
+                    Path.GetFullPath(
+                        RepositoryRoot + @"\LvglWindowsSimulator\")),
+                "LVGL_WINDOWS_SIMULATOR_SOURCES",
+                NewSourceNames);
         }
 
         static void UpdateLvglWindowsDesktopApplication()
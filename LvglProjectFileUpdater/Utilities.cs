@@ -1,4 +1,5 @@
 ﻿using Microsoft.Build.Construction;
+using Mile.Project.Helpers;
 
 namespace LvglProjectFileUpdater
 {
@@ -40,6 +41,33 @@ namespace LvglProjectFileUpdater
             }
         }
 
+        public static void GenerateCMakeSourceList(
+            string OutputFilePath,
+            string VariableName,
+            List<(string Target, string Filter)> SourceNames)
+        {
+            string Content = string.Format(
+                "# This file is generated by LvglProjectFileUpdater.\r\n" +
+                "\r\n" +
+                "set({0}\r\n",
+                VariableName);
+
+            foreach (var SourceName in SourceNames)
+            {
+                Content += string.Format(
+                    "  \"{0}\"\r\n",
+                    SourceName.Target.Replace(
+                        @"$(MSBuildThisFileDirectory)",
+                        @"${CMAKE_CURRENT_LIST_DIR}\").Replace(
+                        '\\',
+                        '/'));
+            }
+
+            Content += ")\r\n";
+
+            FileUtilities.SaveTextToFileAsUtf8Bom(OutputFilePath, Content);
+        }
+
         public static bool CheckProjectItemElementExists(
             ProjectRootElement RootElement,
             string ItemType,
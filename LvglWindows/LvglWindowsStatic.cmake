@@ -0,0 +1,534 @@
+﻿# This file is generated by LvglProjectFileUpdater.
+
+set(LVGL_WINDOWS_STATIC_SOURCES
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_group.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_class.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_draw.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_event.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_id_builtin.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_pos.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_property.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_scroll.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_style.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_style_gen.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_tree.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_observer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_refr.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/monkey/lv_monkey.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/sysmon/lv_sysmon.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/test/lv_test_display.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/test/lv_test_fs.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/test/lv_test_helpers.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/test/lv_test_indev.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/test/lv_test_indev_gesture.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/test/lv_test_screenshot_compare.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/vg_lite_tvg/vg_lite_matrix.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/vg_lite_tvg/vg_lite_tvg.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/display/lv_display.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/convert/helium/lv_draw_buf_convert_helium.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/convert/lv_draw_buf_convert.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/convert/neon/lv_draw_buf_convert_neon.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/dma2d/lv_draw_dma2d.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/dma2d/lv_draw_dma2d_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/dma2d/lv_draw_dma2d_img.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/espressif/ppa/lv_draw_ppa.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/espressif/ppa/lv_draw_ppa_buf.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/espressif/ppa/lv_draw_ppa_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/espressif/ppa/lv_draw_ppa_img.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/eve/lv_draw_eve.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/eve/lv_draw_eve_arc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/eve/lv_draw_eve_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/eve/lv_draw_eve_image.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/eve/lv_draw_eve_letter.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/eve/lv_draw_eve_line.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/eve/lv_draw_eve_ram_g.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/eve/lv_draw_eve_triangle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/eve/lv_eve.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_3d.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_arc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_blur.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_buf.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_image.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_label.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_line.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_mask.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_rect.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_triangle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_vector.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_image_decoder.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_3d.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_arc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_border.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_box_shadow.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_grad.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_image.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_label.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_layer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_line.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_mask_rect.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_triangle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_vector.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_nanovg_fbo_cache.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_nanovg_image_cache.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_nanovg_utils.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_arc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_border.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_img.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_label.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_layer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_line.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_stm32_hal.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_triangle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_utils.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_vector.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_nema_gfx_path.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/g2d/lv_draw_buf_g2d.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/g2d/lv_draw_g2d.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/g2d/lv_draw_g2d_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/g2d/lv_draw_g2d_img.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/g2d/lv_g2d_buf_map.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/g2d/lv_g2d_utils.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/pxp/lv_draw_buf_pxp.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/pxp/lv_draw_pxp.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/pxp/lv_draw_pxp_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/pxp/lv_draw_pxp_img.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/pxp/lv_draw_pxp_layer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/pxp/lv_pxp_cfg.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/pxp/lv_pxp_osa.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/pxp/lv_pxp_utils.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/opengles/lv_draw_opengles.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d_arc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d_border.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d_image.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d_label.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d_line.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d_mask_rectangle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d_triangle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d_utils.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sdl/lv_draw_sdl.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/snapshot/lv_snapshot.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend_to_a8.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend_to_al88.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend_to_argb8888.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend_to_argb8888_premultiplied.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend_to_i1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend_to_l8.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend_to_rgb565.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend_to_rgb565_swapped.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend_to_rgb888.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/neon/lv_draw_sw_blend_neon_to_rgb565.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/neon/lv_draw_sw_blend_neon_to_rgb888.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/riscv_v/lv_draw_sw_blend_riscv_v_to_rgb888.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_arc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_blur.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_border.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_box_shadow.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_grad.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_img.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_letter.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_line.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_mask.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_mask_rect.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_transform.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_triangle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_utils.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_vector.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_buf_vg_lite.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_arc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_border.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_box_shadow.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_img.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_label.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_layer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_line.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_mask_rect.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_triangle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_vector.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_vg_lite_bitmap_font_cache.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_vg_lite_decoder.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_vg_lite_grad.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_vg_lite_math.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_vg_lite_path.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_vg_lite_pending.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_vg_lite_stroke.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_vg_lite_utils.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/drm/lv_linux_drm.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/drm/lv_linux_drm_common.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/drm/lv_linux_drm_egl.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/fb/lv_linux_fbdev.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/ft81x/lv_ft81x.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/ili9341/lv_ili9341.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/lcd/lv_lcd_generic_mipi.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/lovyan_gfx/lv_lovyan_gfx.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/nv3007/lv_nv3007.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/nxp_elcdif/lv_nxp_elcdif.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/renesas_glcdc/lv_renesas_glcdc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/st7735/lv_st7735.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/st7789/lv_st7789.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/st7796/lv_st7796.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/st_ltdc/lv_st_ltdc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/tft_espi/lv_tft_espi.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/draw/eve/lv_draw_eve_display.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/evdev/lv_evdev.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/libinput/lv_libinput.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/libinput/lv_xkb.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/nuttx/lv_nuttx_cache.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/nuttx/lv_nuttx_entry.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/nuttx/lv_nuttx_fbdev.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/nuttx/lv_nuttx_image_cache.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/nuttx/lv_nuttx_lcd.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/nuttx/lv_nuttx_libuv.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/nuttx/lv_nuttx_mouse.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/nuttx/lv_nuttx_profiler.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/nuttx/lv_nuttx_touchscreen.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/assets/lv_opengles_shader.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/glad/src/egl.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/glad/src/gl.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/glad/src/gles2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/lv_opengles_debug.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/lv_opengles_driver.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/lv_opengles_egl.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/lv_opengles_glfw.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/lv_opengles_texture.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/opengl_shader/lv_opengl_shader_manager.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/opengl_shader/lv_opengl_shader_program.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/qnx/lv_qnx.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/sdl/lv_sdl_egl.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/sdl/lv_sdl_keyboard.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/sdl/lv_sdl_mouse.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/sdl/lv_sdl_mousewheel.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/sdl/lv_sdl_sw.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/sdl/lv_sdl_texture.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/sdl/lv_sdl_window.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/uefi/lv_uefi_context.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/uefi/lv_uefi_display.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/uefi/lv_uefi_indev_keyboard.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/uefi/lv_uefi_indev_pointer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/uefi/lv_uefi_indev_touch.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/uefi/lv_uefi_private.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wayland.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wl_egl_backend.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wl_g2d_backend.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wl_keyboard.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wl_pointer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wl_seat.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wl_shm_backend.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wl_touch.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wl_window.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wl_xdg_shell.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/windows/lv_windows_context.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/windows/lv_windows_display.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/windows/lv_windows_input.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/x11/lv_x11_display.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/x11/lv_x11_input.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/binfont_loader/lv_binfont_loader.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/fmt_txt/lv_font_fmt_txt.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/font_manager/lv_font_manager.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/font_manager/lv_font_manager_recycle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/imgfont/lv_imgfont.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_dejavu_16_persian_hebrew.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_10.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_12.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_14.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_14_aligned.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_16.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_18.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_20.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_22.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_24.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_26.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_28.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_28_compressed.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_30.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_32.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_34.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_36.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_38.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_40.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_42.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_44.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_46.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_48.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_8.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_source_han_sans_sc_14_cjk.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_source_han_sans_sc_16_cjk.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_unscii_16.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_unscii_8.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/indev/lv_gridnav.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/indev/lv_indev.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/indev/lv_indev_gesture.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/indev/lv_indev_scroll.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/layouts/flex/lv_flex.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/layouts/grid/lv_grid.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/layouts/lv_layout.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/barcode/code128.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/barcode/lv_barcode.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/bin_decoder/lv_bin_decoder.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/bmp/lv_bmp.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/ffmpeg/lv_ffmpeg.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/freetype/lv_freetype.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/freetype/lv_freetype_glyph.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/freetype/lv_freetype_image.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/freetype/lv_freetype_outline.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/freetype/lv_ftsystem.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/frogfs/src/decomp_raw.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/frogfs/src/frogfs.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_arduino_esp_littlefs.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_arduino_sd.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_cbfs.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_fatfs.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_frogfs.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_littlefs.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_memfs.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_posix.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_stdio.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_uefi.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_win32.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/FT800-FT813/EVE_commands.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/FT800-FT813/EVE_supplemental.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gif/gif.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_data.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_data_animations.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_data_cache.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_data_injest.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_data_mesh.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_data_primitive.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_data_shader.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_data_skin.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_data_texture.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_model_node.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_uniform_locations.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_environment/lv_gltf_ibl_sampler.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_view/assets/chromatic.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_view/assets/lv_gltf_view_shader.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_view/lv_gltf_view.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_view/lv_gltf_view_render.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_view/lv_gltf_view_shader.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/math/lv_3dmath.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/math/lv_gltf_math.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gstreamer/lv_gstreamer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/libjpeg_turbo/lv_libjpeg_turbo.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/libpng/lv_libpng.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/libwebp/lv_libwebp.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/lodepng/lodepng.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/lodepng/lv_lodepng.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/lz4/lz4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/nanovg/nanovg.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/qrcode/lv_qrcode.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/qrcode/qrcodegen.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/rle/lv_rle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/rlottie/lv_rlottie.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/svg/lv_svg.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/svg/lv_svg_decoder.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/svg/lv_svg_parser.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/svg/lv_svg_render.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/svg/lv_svg_token.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgAccessor.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgAnimation.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgCanvas.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgCapi.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgCompressor.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgFill.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgGlCanvas.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgInitializer.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLoader.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLottieAnimation.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLottieBuilder.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLottieExpressions.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLottieInterpolator.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLottieLoader.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLottieModel.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLottieModifier.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLottieParser.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLottieParserHandler.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgMath.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgPaint.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgPicture.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgRawLoader.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgRender.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSaver.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgScene.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgShape.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgStr.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSvgCssStyle.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSvgLoader.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSvgPath.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSvgSceneBuilder.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSvgUtil.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwCanvas.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwFill.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwImage.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwMath.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwMemPool.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwPostEffect.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwRaster.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwRenderer.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwRle.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwShape.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwStroke.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgTaskScheduler.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgText.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgWgCanvas.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgXmlParser.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/tiny_ttf/lv_tiny_ttf.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/tjpgd/lv_tjpgd.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/tjpgd/tjpgd.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/vg_lite_driver/lv_vg_lite_hal/lv_vg_lite_hal.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/vg_lite_driver/lv_vg_lite_hal/vg_lite_os.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/vg_lite_driver/VGLiteKernel/vg_lite_kernel.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/vg_lite_driver/VGLite/vg_lite.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/vg_lite_driver/VGLite/vg_lite_image.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/vg_lite_driver/VGLite/vg_lite_matrix.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/vg_lite_driver/VGLite/vg_lite_path.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/vg_lite_driver/VGLite/vg_lite_stroke.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/lv_init.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/cache/class/lv_cache_lru_ll.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/cache/class/lv_cache_lru_rb.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/cache/class/lv_cache_sc_da.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/cache/instance/lv_image_cache.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/cache/instance/lv_image_header_cache.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/cache/lv_cache.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/cache/lv_cache_entry.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_anim.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_anim_timeline.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_area.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_array.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_async.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_bidi.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_circle_buf.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_color.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_color_op.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_event.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_fs.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_grad.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_iter.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_ll.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_log.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_lru.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_math.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_matrix.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_palette.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_pending.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_profiler_builtin.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_profiler_builtin_posix.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_rb.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_style.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_style_gen.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_templ.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_text.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_text_ap.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_timer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_tree.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_utils.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_cmsis_rtos2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_freertos.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_linux.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_mqx.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_os.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_os_none.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_pthread.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_rtthread.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_sdl2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_windows.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/others/file_explorer/lv_file_explorer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/others/fragment/lv_fragment.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/others/fragment/lv_fragment_manager.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/others/translation/lv_translation.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/builtin/lv_mem_core_builtin.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/builtin/lv_sprintf_builtin.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/builtin/lv_string_builtin.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/builtin/lv_tlsf.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/clib/lv_mem_core_clib.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/clib/lv_sprintf_clib.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/clib/lv_string_clib.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/lv_mem.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/micropython/lv_mem_core_micropython.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/rtthread/lv_mem_core_rtthread.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/rtthread/lv_sprintf_rtthread.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/rtthread/lv_string_rtthread.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/uefi/lv_mem_core_uefi.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/themes/default/lv_theme_default.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/themes/lv_theme.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/themes/mono/lv_theme_mono.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/themes/simple/lv_theme_simple.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/tick/lv_tick.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/3dtexture/lv_3dtexture.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/animimage/lv_animimage.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/arclabel/lv_arclabel.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/arc/lv_arc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/bar/lv_bar.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/buttonmatrix/lv_buttonmatrix.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/button/lv_button.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/calendar/lv_calendar.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/calendar/lv_calendar_chinese.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/calendar/lv_calendar_header_arrow.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/calendar/lv_calendar_header_dropdown.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/canvas/lv_canvas.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/chart/lv_chart.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/checkbox/lv_checkbox.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/dropdown/lv_dropdown.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/gif/lv_gif.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/imagebutton/lv_imagebutton.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/image/lv_image.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/ime/lv_ime_pinyin.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/keyboard/lv_keyboard.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/label/lv_label.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/led/lv_led.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/line/lv_line.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/list/lv_list.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/lottie/lv_lottie.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/menu/lv_menu.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/msgbox/lv_msgbox.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/objx_templ/lv_objx_templ.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_animimage_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_arc_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_bar_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_buttonmatrix_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_chart_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_checkbox_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_dropdown_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_image_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_keyboard_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_label_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_led_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_line_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_menu_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_obj_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_roller_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_scale_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_slider_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_span_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_spinbox_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_spinner_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_style_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_switch_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_table_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_tabview_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_textarea_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/roller/lv_roller.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/scale/lv_scale.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/slider/lv_slider.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/span/lv_span.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/spinbox/lv_spinbox.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/spinner/lv_spinner.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/switch/lv_switch.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/table/lv_table.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/tabview/lv_tabview.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/textarea/lv_textarea.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/tileview/lv_tileview.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/win/lv_win.c"
+)
@@ -1,6 +1,7 @@
 ﻿#include <Windows.h>
 
 #include <LvglWindowsIconResource.h>
+#include <LvglRunLoop.h>
 
 #include "lvgl/lvgl.h"
 #include "lvgl/examples/lv_examples.h"
@@ -18,6 +19,11 @@ int WINAPI wWinMain(
 
     ::lv_init();
 
+    if (!::lv_run_loop_init())
+    {
+        return -1;
+    }
+
     int32_t zoom_level = 100;
     bool allow_dpi_override = false;
     bool simulator_mode = false;
@@ -74,13 +80,18 @@ int WINAPI wWinMain(
         return -1;
     }
 
+    if (!::lv_run_loop_attach_display(display))
+    {
+        return -1;
+    }
+
     ::lv_demo_widgets();
     //::lv_demo_benchmark();
 
     while (1)
     {
-        uint32_t time_till_next = ::lv_timer_handler();
-        ::lv_delay_ms(time_till_next);
+        uint32_t time_till_next = ::lv_run_loop_handler();
+        ::lv_run_loop_wait(time_till_next);
     }
 
     return 0;
@@ -0,0 +1,875 @@
+﻿# This file is generated by LvglProjectFileUpdater.
+
+set(LVGL_WINDOWS_SIMULATOR_SOURCES
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/benchmark/assets/img_benchmark_avatar.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/benchmark/assets/img_benchmark_lvgl_logo_argb.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/benchmark/assets/img_benchmark_lvgl_logo_rgb.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/benchmark/assets/lv_font_benchmark_montserrat_12_aligned.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/benchmark/assets/lv_font_benchmark_montserrat_14_aligned.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/benchmark/assets/lv_font_benchmark_montserrat_16_aligned.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/benchmark/assets/lv_font_benchmark_montserrat_18_aligned.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/benchmark/assets/lv_font_benchmark_montserrat_20_aligned.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/benchmark/assets/lv_font_benchmark_montserrat_24_aligned.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/benchmark/assets/lv_font_benchmark_montserrat_26_aligned.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/benchmark/lv_demo_benchmark.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/gltf/lv_demo_gltf.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/keypad_encoder/lv_demo_keypad_encoder.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/lv_demos.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_btn_corner_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_btn_list_pause.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_btn_list_pause_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_btn_list_play.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_btn_list_play_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_btn_loop.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_btn_loop_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_btn_next.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_btn_next_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_btn_pause.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_btn_pause_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_btn_play.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_btn_play_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_btn_prev.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_btn_prev_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_btn_rnd.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_btn_rnd_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_corner_left.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_corner_left_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_corner_right.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_corner_right_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_cover_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_cover_1_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_cover_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_cover_2_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_cover_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_cover_3_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_icon_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_icon_1_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_icon_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_icon_2_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_icon_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_icon_3_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_icon_4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_icon_4_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_list_border.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_list_border_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_logo.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_slider_knob.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_slider_knob_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_wave_bottom.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_wave_bottom_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_wave_top.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/assets/img_lv_demo_music_wave_top_large.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/lv_demo_music.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/lv_demo_music_list.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/music/lv_demo_music_main.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/render/assets/img_render_arc_bg.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/render/assets/img_render_lvgl_logo_argb8888.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/render/assets/img_render_lvgl_logo_argb8888_premultiplied.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/render/assets/img_render_lvgl_logo_i1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/render/assets/img_render_lvgl_logo_l8.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/render/assets/img_render_lvgl_logo_rgb565.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/render/assets/img_render_lvgl_logo_rgb565a8.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/render/assets/img_render_lvgl_logo_rgb565_swapped.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/render/assets/img_render_lvgl_logo_rgb888.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/render/assets/img_render_lvgl_logo_xrgb8888.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/render/lv_demo_render.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/stress/lv_demo_stress.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/vector_graphic/assets/img_demo_vector_avatar.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/vector_graphic/lv_demo_vector_graphic.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/widgets/assets/img_clothes.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/widgets/assets/img_demo_widgets_avatar.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/widgets/assets/img_demo_widgets_needle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/widgets/assets/img_lvgl_logo.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/widgets/lv_demo_widgets.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/widgets/lv_demo_widgets_analytics.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/widgets/lv_demo_widgets_components.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/widgets/lv_demo_widgets_profile.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/demos/widgets/lv_demo_widgets_shop.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/anim/lv_example_anim_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/anim/lv_example_anim_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/anim/lv_example_anim_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/anim/lv_example_anim_4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/anim/lv_example_anim_timeline_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/assets/animimg001.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/assets/animimg002.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/assets/animimg003.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/assets/emoji/img_emoji_F617.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/assets/imgbtn_left.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/assets/imgbtn_mid.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/assets/imgbtn_right.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/assets/img_caret_down.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/assets/img_cogwheel_argb.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/assets/img_cogwheel_indexed16.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/assets/img_cogwheel_rgb.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/assets/img_hand.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/assets/img_multilang_like.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/assets/img_skew_strip.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/assets/img_star.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/assets/img_svg_img.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/assets/img_transform_avatar_15.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/event/lv_example_event_bubble.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/event/lv_example_event_button.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/event/lv_example_event_click.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/event/lv_example_event_draw.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/event/lv_example_event_streak.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/event/lv_example_event_trickle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/get_started/lv_example_get_started_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/get_started/lv_example_get_started_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/get_started/lv_example_get_started_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/get_started/lv_example_get_started_4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/grad/lv_example_grad_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/grad/lv_example_grad_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/grad/lv_example_grad_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/grad/lv_example_grad_4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/layouts/flex/lv_example_flex_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/layouts/flex/lv_example_flex_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/layouts/flex/lv_example_flex_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/layouts/flex/lv_example_flex_4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/layouts/flex/lv_example_flex_5.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/layouts/flex/lv_example_flex_6.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/layouts/grid/lv_example_grid_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/layouts/grid/lv_example_grid_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/layouts/grid/lv_example_grid_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/layouts/grid/lv_example_grid_4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/layouts/grid/lv_example_grid_5.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/layouts/grid/lv_example_grid_6.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/barcode/lv_example_barcode_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/bmp/lv_example_bmp_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/ffmpeg/lv_example_ffmpeg_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/ffmpeg/lv_example_ffmpeg_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/freetype/lv_example_freetype_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/freetype/lv_example_freetype_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/freetype/lv_example_freetype_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/gif/img_bulb_gif.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/gif/lv_example_gif_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/gltf/lv_example_gltf_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/gltf/lv_example_gltf_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/gltf/lv_example_gltf_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/gstreamer/lv_example_gstreamer_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/libjpeg_turbo/lv_example_libjpeg_turbo_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/libpng/img_png_demo.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/libpng/lv_example_libpng_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/libwebp/lv_example_libwebp_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/lodepng/img_wink_png.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/lodepng/lv_example_lodepng_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/qrcode/lv_example_qrcode_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/rlottie/lv_example_rlottie_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/rlottie/lv_example_rlottie_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/rlottie/lv_example_rlottie_approve.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/svg/lv_example_svg_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/svg/lv_example_svg_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/svg/lv_example_svg_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/tiny_ttf/lv_example_tiny_ttf_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/tiny_ttf/lv_example_tiny_ttf_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/tiny_ttf/lv_example_tiny_ttf_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/tiny_ttf/ubuntu_font.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/libs/tjpgd/lv_example_tjpgd_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/file_explorer/lv_example_file_explorer_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/file_explorer/lv_example_file_explorer_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/file_explorer/lv_example_file_explorer_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/font_manager/lv_example_font_manager_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/font_manager/lv_example_font_manager_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/font_manager/lv_example_font_manager_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/fragment/lv_example_fragment_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/fragment/lv_example_fragment_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/gestures/lv_example_gestures.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/gridnav/lv_example_gridnav_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/gridnav/lv_example_gridnav_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/gridnav/lv_example_gridnav_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/gridnav/lv_example_gridnav_4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/gridnav/lv_example_gridnav_5.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/ime/lv_example_ime_pinyin_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/ime/lv_example_ime_pinyin_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/imgfont/lv_example_imgfont_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/monkey/lv_example_monkey_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/monkey/lv_example_monkey_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/monkey/lv_example_monkey_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/observer/lv_example_observer_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/observer/lv_example_observer_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/observer/lv_example_observer_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/observer/lv_example_observer_4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/observer/lv_example_observer_5.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/observer/lv_example_observer_6.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/observer/lv_example_observer_7.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/snapshot/lv_example_snapshot_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/translation/lv_example_translation_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/others/translation/lv_example_translation_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/porting/lv_port_disp_template.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/porting/lv_port_fs_template.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/porting/lv_port_indev_template.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/porting/lv_port_lcd_stm32_template.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/porting/osal/lv_example_osal.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/scroll/lv_example_scroll_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/scroll/lv_example_scroll_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/scroll/lv_example_scroll_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/scroll/lv_example_scroll_4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/scroll/lv_example_scroll_5.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/scroll/lv_example_scroll_6.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/scroll/lv_example_scroll_7.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/scroll/lv_example_scroll_8.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/scroll/lv_example_scroll_9.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_10.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_11.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_12.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_13.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_14.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_15.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_16.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_17.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_18.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_19.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_20.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_21.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_5.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_6.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_7.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_8.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/styles/lv_example_style_9.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/animimg/lv_example_animimg_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/arclabel/lv_example_arclabel_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/arc/lv_example_arc_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/arc/lv_example_arc_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/arc/lv_example_arc_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/bar/lv_example_bar_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/bar/lv_example_bar_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/bar/lv_example_bar_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/bar/lv_example_bar_4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/bar/lv_example_bar_5.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/bar/lv_example_bar_6.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/bar/lv_example_bar_7.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/buttonmatrix/lv_example_buttonmatrix_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/buttonmatrix/lv_example_buttonmatrix_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/buttonmatrix/lv_example_buttonmatrix_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/button/lv_example_button_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/button/lv_example_button_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/button/lv_example_button_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/calendar/lv_example_calendar_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/calendar/lv_example_calendar_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/canvas/lv_example_canvas_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/canvas/lv_example_canvas_10.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/canvas/lv_example_canvas_11.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/canvas/lv_example_canvas_12.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/canvas/lv_example_canvas_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/canvas/lv_example_canvas_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/canvas/lv_example_canvas_4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/canvas/lv_example_canvas_5.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/canvas/lv_example_canvas_6.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/canvas/lv_example_canvas_7.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/canvas/lv_example_canvas_8.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/canvas/lv_example_canvas_9.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/chart/lv_example_chart_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/chart/lv_example_chart_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/chart/lv_example_chart_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/chart/lv_example_chart_4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/chart/lv_example_chart_5.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/chart/lv_example_chart_6.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/chart/lv_example_chart_7.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/chart/lv_example_chart_8.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/checkbox/lv_example_checkbox_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/checkbox/lv_example_checkbox_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/dropdown/lv_example_dropdown_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/dropdown/lv_example_dropdown_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/dropdown/lv_example_dropdown_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/imagebutton/lv_example_imagebutton_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/image/lv_example_image_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/image/lv_example_image_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/image/lv_example_image_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/image/lv_example_image_4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/image/lv_example_image_5.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/keyboard/lv_example_keyboard_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/keyboard/lv_example_keyboard_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/keyboard/lv_example_keyboard_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/label/lv_example_label_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/label/lv_example_label_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/label/lv_example_label_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/label/lv_example_label_4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/label/lv_example_label_5.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/label/lv_example_label_6.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/label/lv_example_label_7.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/led/lv_example_led_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/line/lv_example_line_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/list/lv_example_list_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/list/lv_example_list_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/lottie/lv_example_lottie_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/lottie/lv_example_lottie_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/lottie/lv_example_lottie_approve.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/menu/lv_example_menu_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/menu/lv_example_menu_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/menu/lv_example_menu_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/menu/lv_example_menu_4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/menu/lv_example_menu_5.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/msgbox/lv_example_msgbox_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/msgbox/lv_example_msgbox_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/msgbox/lv_example_msgbox_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/obj/lv_example_obj_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/obj/lv_example_obj_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/obj/lv_example_obj_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/roller/lv_example_roller_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/roller/lv_example_roller_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/roller/lv_example_roller_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/scale/lv_example_scale_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/scale/lv_example_scale_10.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/scale/lv_example_scale_11.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/scale/lv_example_scale_12.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/scale/lv_example_scale_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/scale/lv_example_scale_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/scale/lv_example_scale_4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/scale/lv_example_scale_5.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/scale/lv_example_scale_6.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/scale/lv_example_scale_7.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/scale/lv_example_scale_8.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/scale/lv_example_scale_9.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/slider/lv_example_slider_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/slider/lv_example_slider_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/slider/lv_example_slider_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/slider/lv_example_slider_4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/span/lv_example_span_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/spinbox/lv_example_spinbox_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/spinner/lv_example_spinner_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/switch/lv_example_switch_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/switch/lv_example_switch_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/table/lv_example_table_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/table/lv_example_table_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/tabview/lv_example_tabview_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/tabview/lv_example_tabview_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/textarea/lv_example_textarea_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/textarea/lv_example_textarea_2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/textarea/lv_example_textarea_3.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/textarea/lv_example_textarea_4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/tileview/lv_example_tileview_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/examples/widgets/win/lv_example_win_1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_group.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_class.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_draw.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_event.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_id_builtin.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_pos.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_property.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_scroll.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_style.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_style_gen.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_obj_tree.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_observer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/core/lv_refr.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/monkey/lv_monkey.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/sysmon/lv_sysmon.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/test/lv_test_display.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/test/lv_test_fs.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/test/lv_test_helpers.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/test/lv_test_indev.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/test/lv_test_indev_gesture.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/test/lv_test_screenshot_compare.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/vg_lite_tvg/vg_lite_matrix.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/debugging/vg_lite_tvg/vg_lite_tvg.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/display/lv_display.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/convert/helium/lv_draw_buf_convert_helium.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/convert/lv_draw_buf_convert.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/convert/neon/lv_draw_buf_convert_neon.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/dma2d/lv_draw_dma2d.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/dma2d/lv_draw_dma2d_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/dma2d/lv_draw_dma2d_img.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/espressif/ppa/lv_draw_ppa.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/espressif/ppa/lv_draw_ppa_buf.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/espressif/ppa/lv_draw_ppa_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/espressif/ppa/lv_draw_ppa_img.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/eve/lv_draw_eve.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/eve/lv_draw_eve_arc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/eve/lv_draw_eve_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/eve/lv_draw_eve_image.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/eve/lv_draw_eve_letter.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/eve/lv_draw_eve_line.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/eve/lv_draw_eve_ram_g.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/eve/lv_draw_eve_triangle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/eve/lv_eve.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_3d.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_arc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_blur.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_buf.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_image.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_label.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_line.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_mask.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_rect.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_triangle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_draw_vector.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/lv_image_decoder.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_3d.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_arc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_border.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_box_shadow.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_grad.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_image.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_label.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_layer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_line.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_mask_rect.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_triangle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_draw_nanovg_vector.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_nanovg_fbo_cache.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_nanovg_image_cache.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nanovg/lv_nanovg_utils.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_arc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_border.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_img.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_label.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_layer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_line.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_stm32_hal.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_triangle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_utils.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_draw_nema_gfx_vector.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nema_gfx/lv_nema_gfx_path.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/g2d/lv_draw_buf_g2d.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/g2d/lv_draw_g2d.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/g2d/lv_draw_g2d_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/g2d/lv_draw_g2d_img.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/g2d/lv_g2d_buf_map.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/g2d/lv_g2d_utils.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/pxp/lv_draw_buf_pxp.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/pxp/lv_draw_pxp.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/pxp/lv_draw_pxp_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/pxp/lv_draw_pxp_img.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/pxp/lv_draw_pxp_layer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/pxp/lv_pxp_cfg.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/pxp/lv_pxp_osa.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/nxp/pxp/lv_pxp_utils.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/opengles/lv_draw_opengles.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d_arc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d_border.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d_image.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d_label.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d_line.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d_mask_rectangle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d_triangle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/renesas/dave2d/lv_draw_dave2d_utils.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sdl/lv_draw_sdl.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/snapshot/lv_snapshot.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend_to_a8.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend_to_al88.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend_to_argb8888.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend_to_argb8888_premultiplied.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend_to_i1.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend_to_l8.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend_to_rgb565.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend_to_rgb565_swapped.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/lv_draw_sw_blend_to_rgb888.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/neon/lv_draw_sw_blend_neon_to_rgb565.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/neon/lv_draw_sw_blend_neon_to_rgb888.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/blend/riscv_v/lv_draw_sw_blend_riscv_v_to_rgb888.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_arc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_blur.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_border.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_box_shadow.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_grad.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_img.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_letter.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_line.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_mask.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_mask_rect.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_transform.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_triangle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_utils.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/sw/lv_draw_sw_vector.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_buf_vg_lite.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_arc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_border.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_box_shadow.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_fill.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_img.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_label.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_layer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_line.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_mask_rect.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_triangle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_draw_vg_lite_vector.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_vg_lite_bitmap_font_cache.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_vg_lite_decoder.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_vg_lite_grad.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_vg_lite_math.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_vg_lite_path.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_vg_lite_pending.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_vg_lite_stroke.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/draw/vg_lite/lv_vg_lite_utils.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/drm/lv_linux_drm.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/drm/lv_linux_drm_common.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/drm/lv_linux_drm_egl.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/fb/lv_linux_fbdev.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/ft81x/lv_ft81x.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/ili9341/lv_ili9341.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/lcd/lv_lcd_generic_mipi.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/lovyan_gfx/lv_lovyan_gfx.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/nv3007/lv_nv3007.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/nxp_elcdif/lv_nxp_elcdif.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/renesas_glcdc/lv_renesas_glcdc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/st7735/lv_st7735.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/st7789/lv_st7789.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/st7796/lv_st7796.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/st_ltdc/lv_st_ltdc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/display/tft_espi/lv_tft_espi.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/draw/eve/lv_draw_eve_display.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/evdev/lv_evdev.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/libinput/lv_libinput.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/libinput/lv_xkb.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/nuttx/lv_nuttx_cache.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/nuttx/lv_nuttx_entry.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/nuttx/lv_nuttx_fbdev.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/nuttx/lv_nuttx_image_cache.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/nuttx/lv_nuttx_lcd.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/nuttx/lv_nuttx_libuv.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/nuttx/lv_nuttx_mouse.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/nuttx/lv_nuttx_profiler.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/nuttx/lv_nuttx_touchscreen.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/assets/lv_opengles_shader.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/glad/src/egl.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/glad/src/gl.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/glad/src/gles2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/lv_opengles_debug.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/lv_opengles_driver.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/lv_opengles_egl.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/lv_opengles_glfw.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/lv_opengles_texture.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/opengl_shader/lv_opengl_shader_manager.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/opengles/opengl_shader/lv_opengl_shader_program.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/qnx/lv_qnx.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/sdl/lv_sdl_egl.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/sdl/lv_sdl_keyboard.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/sdl/lv_sdl_mouse.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/sdl/lv_sdl_mousewheel.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/sdl/lv_sdl_sw.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/sdl/lv_sdl_texture.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/sdl/lv_sdl_window.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/uefi/lv_uefi_context.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/uefi/lv_uefi_display.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/uefi/lv_uefi_indev_keyboard.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/uefi/lv_uefi_indev_pointer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/uefi/lv_uefi_indev_touch.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/uefi/lv_uefi_private.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wayland.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wl_egl_backend.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wl_g2d_backend.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wl_keyboard.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wl_pointer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wl_seat.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wl_shm_backend.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wl_touch.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wl_window.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/wayland/lv_wl_xdg_shell.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/windows/lv_windows_context.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/windows/lv_windows_display.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/windows/lv_windows_input.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/x11/lv_x11_display.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/drivers/x11/lv_x11_input.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/binfont_loader/lv_binfont_loader.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/fmt_txt/lv_font_fmt_txt.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/font_manager/lv_font_manager.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/font_manager/lv_font_manager_recycle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/imgfont/lv_imgfont.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_dejavu_16_persian_hebrew.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_10.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_12.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_14.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_14_aligned.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_16.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_18.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_20.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_22.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_24.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_26.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_28.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_28_compressed.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_30.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_32.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_34.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_36.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_38.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_40.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_42.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_44.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_46.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_48.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_montserrat_8.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_source_han_sans_sc_14_cjk.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_source_han_sans_sc_16_cjk.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_unscii_16.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/font/lv_font_unscii_8.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/indev/lv_gridnav.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/indev/lv_indev.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/indev/lv_indev_gesture.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/indev/lv_indev_scroll.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/layouts/flex/lv_flex.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/layouts/grid/lv_grid.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/layouts/lv_layout.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/barcode/code128.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/barcode/lv_barcode.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/bin_decoder/lv_bin_decoder.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/bmp/lv_bmp.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/ffmpeg/lv_ffmpeg.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/freetype/lv_freetype.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/freetype/lv_freetype_glyph.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/freetype/lv_freetype_image.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/freetype/lv_freetype_outline.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/freetype/lv_ftsystem.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/frogfs/src/decomp_raw.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/frogfs/src/frogfs.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_arduino_esp_littlefs.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_arduino_sd.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_cbfs.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_fatfs.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_frogfs.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_littlefs.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_memfs.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_posix.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_stdio.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_uefi.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/fsdrv/lv_fs_win32.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/FT800-FT813/EVE_commands.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/FT800-FT813/EVE_supplemental.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gif/gif.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_data.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_data_animations.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_data_cache.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_data_injest.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_data_mesh.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_data_primitive.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_data_shader.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_data_skin.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_data_texture.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_model_node.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_data/lv_gltf_uniform_locations.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_environment/lv_gltf_ibl_sampler.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_view/assets/chromatic.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_view/assets/lv_gltf_view_shader.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_view/lv_gltf_view.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_view/lv_gltf_view_render.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/gltf_view/lv_gltf_view_shader.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/math/lv_3dmath.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gltf/math/lv_gltf_math.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/gstreamer/lv_gstreamer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/libjpeg_turbo/lv_libjpeg_turbo.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/libpng/lv_libpng.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/libwebp/lv_libwebp.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/lodepng/lodepng.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/lodepng/lv_lodepng.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/lz4/lz4.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/nanovg/nanovg.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/qrcode/lv_qrcode.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/qrcode/qrcodegen.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/rle/lv_rle.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/rlottie/lv_rlottie.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/svg/lv_svg.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/svg/lv_svg_decoder.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/svg/lv_svg_parser.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/svg/lv_svg_render.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/svg/lv_svg_token.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgAccessor.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgAnimation.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgCanvas.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgCapi.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgCompressor.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgFill.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgGlCanvas.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgInitializer.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLoader.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLottieAnimation.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLottieBuilder.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLottieExpressions.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLottieInterpolator.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLottieLoader.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLottieModel.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLottieModifier.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLottieParser.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgLottieParserHandler.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgMath.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgPaint.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgPicture.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgRawLoader.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgRender.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSaver.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgScene.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgShape.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgStr.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSvgCssStyle.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSvgLoader.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSvgPath.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSvgSceneBuilder.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSvgUtil.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwCanvas.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwFill.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwImage.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwMath.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwMemPool.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwPostEffect.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwRaster.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwRenderer.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwRle.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwShape.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgSwStroke.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgTaskScheduler.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgText.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgWgCanvas.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/thorvg/tvgXmlParser.cpp"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/tiny_ttf/lv_tiny_ttf.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/tjpgd/lv_tjpgd.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/tjpgd/tjpgd.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/vg_lite_driver/lv_vg_lite_hal/lv_vg_lite_hal.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/vg_lite_driver/lv_vg_lite_hal/vg_lite_os.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/vg_lite_driver/VGLiteKernel/vg_lite_kernel.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/vg_lite_driver/VGLite/vg_lite.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/vg_lite_driver/VGLite/vg_lite_image.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/vg_lite_driver/VGLite/vg_lite_matrix.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/vg_lite_driver/VGLite/vg_lite_path.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/libs/vg_lite_driver/VGLite/vg_lite_stroke.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/lv_init.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/cache/class/lv_cache_lru_ll.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/cache/class/lv_cache_lru_rb.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/cache/class/lv_cache_sc_da.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/cache/instance/lv_image_cache.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/cache/instance/lv_image_header_cache.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/cache/lv_cache.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/cache/lv_cache_entry.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_anim.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_anim_timeline.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_area.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_array.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_async.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_bidi.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_circle_buf.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_color.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_color_op.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_event.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_fs.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_grad.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_iter.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_ll.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_log.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_lru.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_math.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_matrix.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_palette.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_pending.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_profiler_builtin.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_profiler_builtin_posix.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_rb.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_style.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_style_gen.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_templ.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_text.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_text_ap.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_timer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_tree.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/misc/lv_utils.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_cmsis_rtos2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_freertos.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_linux.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_mqx.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_os.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_os_none.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_pthread.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_rtthread.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_sdl2.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/osal/lv_windows.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/others/file_explorer/lv_file_explorer.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/others/fragment/lv_fragment.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/others/fragment/lv_fragment_manager.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/others/translation/lv_translation.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/builtin/lv_mem_core_builtin.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/builtin/lv_sprintf_builtin.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/builtin/lv_string_builtin.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/builtin/lv_tlsf.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/clib/lv_mem_core_clib.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/clib/lv_sprintf_clib.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/clib/lv_string_clib.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/lv_mem.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/micropython/lv_mem_core_micropython.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/rtthread/lv_mem_core_rtthread.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/rtthread/lv_sprintf_rtthread.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/rtthread/lv_string_rtthread.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/stdlib/uefi/lv_mem_core_uefi.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/themes/default/lv_theme_default.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/themes/lv_theme.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/themes/mono/lv_theme_mono.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/themes/simple/lv_theme_simple.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/tick/lv_tick.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/3dtexture/lv_3dtexture.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/animimage/lv_animimage.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/arclabel/lv_arclabel.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/arc/lv_arc.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/bar/lv_bar.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/buttonmatrix/lv_buttonmatrix.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/button/lv_button.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/calendar/lv_calendar.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/calendar/lv_calendar_chinese.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/calendar/lv_calendar_header_arrow.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/calendar/lv_calendar_header_dropdown.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/canvas/lv_canvas.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/chart/lv_chart.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/checkbox/lv_checkbox.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/dropdown/lv_dropdown.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/gif/lv_gif.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/imagebutton/lv_imagebutton.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/image/lv_image.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/ime/lv_ime_pinyin.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/keyboard/lv_keyboard.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/label/lv_label.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/led/lv_led.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/line/lv_line.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/list/lv_list.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/lottie/lv_lottie.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/menu/lv_menu.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/msgbox/lv_msgbox.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/objx_templ/lv_objx_templ.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_animimage_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_arc_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_bar_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_buttonmatrix_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_chart_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_checkbox_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_dropdown_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_image_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_keyboard_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_label_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_led_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_line_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_menu_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_obj_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_roller_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_scale_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_slider_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_span_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_spinbox_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_spinner_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_style_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_switch_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_table_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_tabview_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/property/lv_textarea_properties.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/roller/lv_roller.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/scale/lv_scale.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/slider/lv_slider.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/span/lv_span.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/spinbox/lv_spinbox.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/spinner/lv_spinner.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/switch/lv_switch.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/table/lv_table.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/tabview/lv_tabview.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/textarea/lv_textarea.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/tileview/lv_tileview.c"
+  "${CMAKE_CURRENT_LIST_DIR}/../LvglPlatform/lvgl/src/widgets/win/lv_win.c"
+)
@@ -1,26 +1,40 @@
-﻿#include <Windows.h>
+﻿#ifdef _WIN32
+#include <Windows.h>
 
 #include <LvglWindowsIconResource.h>
+#endif
+#include <LvglAdaptiveRefresh.h>
+#include <LvglAllocationTracer.h>
+#include <LvglHeadlessDisplay.h>
+#include <LvglBenchmarkRunner.h>
+#include <LvglBenchmarkScenes.h>
+#include <LvglCircleCache.h>
+#include <LvglDirtyAreaCoalescer.h>
+#include <LvglDisplayBuffering.h>
+#include <LvglDrawCache.h>
+#include <LvglFrameHistogram.h>
+#include <LvglFrameScheduler.h>
+#include <LvglParallelDraw.h>
+#include <LvglProfilerTrace.h>
+#include <LvglRunLoop.h>
+#include <LvglShadowCache.h>
+#include <LvglSimdBlend.h>
+#include <LvglSlabAllocator.h>
+#include <LvglStatsMonitor.h>
+#include <LvglStyleCache.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 
 #include "lvgl/lvgl.h"
 #include "lvgl/examples/lv_examples.h"
 #include "lvgl/demos/lv_demos.h"
 
-int main()
+static lv_display_t* create_simulator_display()
 {
-    lv_init();
-
-    /*
-     * Optional workaround for users who wants UTF-8 console output.
-     * If you don't want that behavior can comment them out.
-     *
-     * Suggested by jinsc123654.
-     */
-#if LV_TXT_ENC == LV_TXT_ENC_UTF8
-    SetConsoleCP(CP_UTF8);
-    SetConsoleOutputCP(CP_UTF8);
-#endif
-
+#ifdef _WIN32
     int32_t zoom_level = 100;
     bool allow_dpi_override = false;
     bool simulator_mode = true;
@@ -33,13 +47,13 @@ int main()
         simulator_mode);
     if (!display)
     {
-        return -1;
+        return NULL;
     }
 
     HWND window_handle = lv_windows_get_display_window_handle(display);
     if (!window_handle)
     {
-        return -1;
+        return NULL;
     }
 
     HICON icon_handle = LoadIconW(
@@ -62,28 +76,722 @@ int main()
     lv_indev_t* pointer_indev = lv_windows_acquire_pointer_indev(display);
     if (!pointer_indev)
     {
-        return -1;
+        return NULL;
     }
 
     lv_indev_t* keypad_indev = lv_windows_acquire_keypad_indev(display);
     if (!keypad_indev)
     {
-        return -1;
+        return NULL;
     }
 
     lv_indev_t* encoder_indev = lv_windows_acquire_encoder_indev(display);
     if (!encoder_indev)
+    {
+        return NULL;
+    }
+
+    return display;
+#else
+    // The window backend is only available on Windows, use --headless.
+    return NULL;
+#endif
+}
+
+/*
+ * Usage: LvglWindowsSimulator [--headless] [--duration=<ms>]
+ *                             [--demo=widgets|benchmark|image-cache]
+ *                             [--benchmark-output=<path>]
+ *                             [--benchmark-frames=<count>]
+ *                             [--benchmark-scene-timeout=<ms>]
+ *                             [--draw-workers=<count>]
+ *                             [--draw-tile-size=<width>x<height>]
+ *                             [--draw-cache-size=<bytes>]
+ *                             [--draw-cache-dump]
+ *                             [--shadow-cache-size=<bytes>]
+ *                             [--circle-cache-size=<bytes>]
+ *                             [--blend-self-test]
+ *                             [--style-benchmark]
+ *                             [--alloc-benchmark]
+ *                             [--alloc-trace=<path>]
+ *                             [--profile-trace=<path>]
+ *                             [--frame-pacing=off|vsync|<hz>]
+ *                             [--adaptive-refresh=<ms>]
+ *                             [--display-buffering=none|partial|double|triple]
+ *                             [--flush-queue-depth=<count>]
+ *                             [--dirty-area-overhead=<pixels>]
+ *                             [--render-cost=<us>]
+ *
+ * --headless      Render into an in-memory framebuffer instead of a window,
+ *                 which is useful for measuring the rendering performance on
+ *                 machines without a GPU or display server. It is always
+ *                 enabled on non-Windows hosts.
+ * --duration=<ms> Exit after running the specified time. 0 means forever.
+ * --demo=<name>   Select the demo to run. The default is widgets. The
+ *                 image-cache demo is a single benchmark scene of indexed
+ *                 color images, which shows the difference made by the image
+ *                 cache.
+ * --benchmark-output=<path>
+ *                 Run lv_demo_benchmark, or the image-cache demo if it is
+ *                 selected by --demo, write the per-scene results to the
+ *                 specified JSON or CSV file, and exit when it is finished.
+ *                 When running headless, the synthetic clock is used, so
+ *                 every scene renders a fixed number of frames as fast as
+ *                 possible.
+ * --benchmark-frames=<count>
+ *                 The maximum number of measured frames for each scene. The
+ *                 default is 0, which means all frames.
+ * --benchmark-scene-timeout=<ms>
+ *                 Treat the benchmark as finished if no new scene is loaded
+ *                 in the specified time. The default is 20000.
+ * --draw-workers=<count>
+ *                 The number of worker threads of the work-stealing parallel
+ *                 software draw unit. The default is one worker per
+ *                 processor. 0 means only using the built-in software draw
+ *                 units of LVGL.
+ * --draw-tile-size=<width>x<height>
+ *                 The tile size in pixels used by the parallel software draw
+ *                 unit to split the large draw tasks. The default is 0x64,
+ *                 which means 64 rows of the whole draw area. A height of 0
+ *                 disables the tile mode.
+ * --draw-cache-size=<bytes>
+ *                 The unified budget of the image, image header, shadow and
+ *                 circle caches. The default is 8388608. 0 disables all of
+ *                 them.
+ * --draw-cache-dump
+ *                 Print the state of the draw caches before exiting.
+ * --shadow-cache-size=<bytes>
+ *                 Override the budget of the box shadow mask cache used by
+ *                 the parallel software draw unit. The default is 1/8 of the
+ *                 draw cache budget. 0 disables the cache.
+ * --circle-cache-size=<bytes>
+ *                 Override the budget of the rounded corner mask cache used by
+ *                 the parallel software draw unit. The default is 1/32 of the
+ *                 draw cache budget. 0 disables the cache.
+ * --blend-self-test
+ *                 Check whether the SIMD blend kernels are bit-exact against
+ *                 the C implementation, print the throughput of every kernel
+ *                 and exit.
+ * --style-benchmark
+ *                 Measure the throughput of the style property lookups over a
+ *                 widget tree of 5000 objects with and without the resolved
+ *                 style property cache, print the results and exit.
+ * --alloc-benchmark
+ *                 Measure the time of creating, rendering and deleting the
+ *                 widgets demo with the LV_USE_STDLIB_MALLOC backend of the
+ *                 build, print the results and exit.
+ * --alloc-trace=<path>
+ *                 Record the recent allocations of LVGL with their backtraces
+ *                 and lifetimes, and write the allocations per frame, per
+ *                 subsystem and per LVGL function to the specified JSON file
+ *                 before exiting. It needs LV_STDLIB_CUSTOM as the
+ *                 LV_USE_STDLIB_MALLOC backend.
+ * --profile-trace=<path>
+ *                 Enable the profiler of LVGL, and write the refresh, draw
+ *                 and layout timelines of every thread to the specified
+ *                 Chrome trace JSON file before exiting, or when F12 is
+ *                 pressed in the window on Windows or SIGUSR1 is received on
+ *                 POSIX hosts.
+ * --frame-pacing=off|vsync|<hz>
+ *                 Start the refreshes on the vsyncs instead of every
+ *                 LV_DEF_REFR_PERIOD. vsync follows the compositor of the
+ *                 host, or the refresh rate of the monitor if there is no
+ *                 such vsync source, and <hz> uses a fixed refresh rate. The
+ *                 refreshes which would miss the next vsync are skipped. The
+ *                 default is vsync for the window and off when running
+ *                 headless, where the headless display signals the vsyncs
+ *                 of <hz>, or every LV_DEF_REFR_PERIOD for vsync, from the
+ *                 synthetic clock when it is used by the benchmark.
+ * --adaptive-refresh=<ms>
+ *                 Double the refresh period after every refresh without any
+ *                 invalidation, running animation or input, up to the
+ *                 specified period, and reset it on the first invalidation
+ *                 or input. The default is 1000 for the window and 0 when
+ *                 running headless, which disables it.
+ * --display-buffering=none|partial|double|triple
+ *                 Render into two partial buffers, or two or three full size
+ *                 buffers, and copy the rendered areas to the window or the
+ *                 framebuffer on a presenter thread, so the next frame is
+ *                 rendered while the previous one is presented. The default
+ *                 is none, which renders into the framebuffer directly.
+ * --flush-queue-depth=<count>
+ *                 The maximum number of areas or frames queued to the
+ *                 presenter thread of the display buffering. The default is
+ *                 2. The partial mode uses one more buffer than the depth.
+ * --dirty-area-overhead=<pixels>
+ *                 The fixed cost of rendering an area in pixels, which decides
+ *                 whether the invalidated areas are merged, split or kept
+ *                 separately. The default is 4096. 0 means only the pixel
+ *                 count is considered.
+ * --render-cost=<us>
+ *                 Add the specified time to the rendering of every frame when
+ *                 running headless, which advances the synthetic clock, so
+ *                 the frame skipping of --frame-pacing can be tested. The
+ *                 default is 0.
+ */
+int main(int argc, char* argv[])
+{
+#ifdef _WIN32
+    bool headless_mode = false;
+#else
+    bool headless_mode = true;
+#endif
+    uint32_t duration = 0;
+    bool benchmark_demo = false;
+    bool image_cache_demo = false;
+    const char* benchmark_output = NULL;
+    uint32_t benchmark_frames = 0;
+    uint32_t benchmark_scene_timeout = 20000;
+    bool parallel_draw = true;
+    uint32_t draw_workers = 0;
+    int32_t draw_tile_width = LV_PARALLEL_DRAW_TILE_WIDTH;
+    int32_t draw_tile_height = LV_PARALLEL_DRAW_TILE_HEIGHT;
+    size_t draw_cache_size = LV_DRAW_CACHE_SIZE;
+    bool draw_cache_dump = false;
+    // SIZE_MAX means using the share of the draw cache budget.
+    size_t shadow_cache_size = SIZE_MAX;
+    size_t circle_cache_size = SIZE_MAX;
+    bool style_benchmark = false;
+    bool alloc_benchmark = false;
+    const char* alloc_trace_output = NULL;
+    const char* profile_trace_output = NULL;
+    bool synthetic_clock = false;
+    // -1 means only enabling the frame scheduler for the window.
+    int frame_pacing = -1;
+    // 0 means following the vsyncs of the host.
+    uint32_t frame_pacing_period = 0;
+    // UINT32_MAX means only enabling the adaptive refresh for the window.
+    uint32_t adaptive_refresh_period = UINT32_MAX;
+    bool display_buffering = false;
+    lv_display_buffering_mode_t display_buffering_mode =
+        LV_DISPLAY_BUFFERING_MODE_DOUBLE;
+    uint32_t flush_queue_depth = LV_DISPLAY_BUFFERING_QUEUE_DEPTH;
+    uint32_t dirty_area_overhead = LV_DIRTY_AREA_COALESCER_AREA_OVERHEAD;
+    uint32_t render_cost = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (0 == std::strcmp(argv[i], "--headless"))
+        {
+            headless_mode = true;
+        }
+        else if (0 == std::strncmp(argv[i], "--duration=", 11))
+        {
+            duration = std::strtoul(argv[i] + 11, NULL, 10);
+        }
+        else if (0 == std::strcmp(argv[i], "--demo=widgets"))
+        {
+            benchmark_demo = false;
+            image_cache_demo = false;
+        }
+        else if (0 == std::strcmp(argv[i], "--demo=benchmark"))
+        {
+            benchmark_demo = true;
+            image_cache_demo = false;
+        }
+        else if (0 == std::strcmp(argv[i], "--demo=image-cache"))
+        {
+            benchmark_demo = false;
+            image_cache_demo = true;
+        }
+        else if (0 == std::strncmp(argv[i], "--benchmark-output=", 19))
+        {
+            benchmark_output = argv[i] + 19;
+        }
+        else if (0 == std::strncmp(argv[i], "--benchmark-frames=", 19))
+        {
+            benchmark_frames = std::strtoul(argv[i] + 19, NULL, 10);
+        }
+        else if (0 == std::strncmp(argv[i], "--benchmark-scene-timeout=", 26))
+        {
+            benchmark_scene_timeout = std::strtoul(argv[i] + 26, NULL, 10);
+        }
+        else if (0 == std::strncmp(argv[i], "--draw-workers=", 15))
+        {
+            draw_workers = std::strtoul(argv[i] + 15, NULL, 10);
+            parallel_draw = draw_workers != 0;
+        }
+        else if (0 == std::strncmp(argv[i], "--draw-tile-size=", 17))
+        {
+            char* height = NULL;
+            draw_tile_width = std::strtol(argv[i] + 17, &height, 10);
+            draw_tile_height = ('x' == *height)
+                ? std::strtol(height + 1, NULL, 10)
+                : draw_tile_width;
+        }
+        else if (0 == std::strncmp(argv[i], "--draw-cache-size=", 18))
+        {
+            draw_cache_size = std::strtoull(argv[i] + 18, NULL, 10);
+        }
+        else if (0 == std::strcmp(argv[i], "--draw-cache-dump"))
+        {
+            draw_cache_dump = true;
+        }
+        else if (0 == std::strncmp(argv[i], "--shadow-cache-size=", 20))
+        {
+            shadow_cache_size = std::strtoul(argv[i] + 20, NULL, 10);
+        }
+        else if (0 == std::strncmp(argv[i], "--circle-cache-size=", 20))
+        {
+            circle_cache_size = std::strtoul(argv[i] + 20, NULL, 10);
+        }
+        else if (0 == std::strcmp(argv[i], "--blend-self-test"))
+        {
+            std::printf(
+                "Blend instruction set: %s\n",
+                lv_simd_blend_get_instruction_set());
+            return lv_simd_blend_self_test() ? 0 : 1;
+        }
+        else if (0 == std::strcmp(argv[i], "--style-benchmark"))
+        {
+            style_benchmark = true;
+        }
+        else if (0 == std::strcmp(argv[i], "--alloc-benchmark"))
+        {
+            alloc_benchmark = true;
+        }
+        else if (0 == std::strncmp(argv[i], "--alloc-trace=", 14))
+        {
+            alloc_trace_output = argv[i] + 14;
+        }
+        else if (0 == std::strncmp(argv[i], "--profile-trace=", 16))
+        {
+            profile_trace_output = argv[i] + 16;
+        }
+        else if (0 == std::strcmp(argv[i], "--frame-pacing=off"))
+        {
+            frame_pacing = 0;
+        }
+        else if (0 == std::strcmp(argv[i], "--frame-pacing=vsync"))
+        {
+            frame_pacing = 1;
+            frame_pacing_period = 0;
+        }
+        else if (0 == std::strncmp(argv[i], "--frame-pacing=", 15))
+        {
+            uint32_t refresh_rate = std::strtoul(argv[i] + 15, NULL, 10);
+            if (!refresh_rate)
+            {
+                std::fprintf(stderr, "Invalid frame pacing mode.\n");
+                return -1;
+            }
+            frame_pacing = 1;
+            frame_pacing_period = 1000000 / refresh_rate;
+        }
+        else if (0 == std::strncmp(argv[i], "--adaptive-refresh=", 19))
+        {
+            adaptive_refresh_period = std::strtoul(argv[i] + 19, NULL, 10);
+        }
+        else if (0 == std::strcmp(argv[i], "--display-buffering=none"))
+        {
+            display_buffering = false;
+        }
+        else if (0 == std::strcmp(argv[i], "--display-buffering=partial"))
+        {
+            display_buffering = true;
+            display_buffering_mode = LV_DISPLAY_BUFFERING_MODE_PARTIAL;
+        }
+        else if (0 == std::strcmp(argv[i], "--display-buffering=double"))
+        {
+            display_buffering = true;
+            display_buffering_mode = LV_DISPLAY_BUFFERING_MODE_DOUBLE;
+        }
+        else if (0 == std::strcmp(argv[i], "--display-buffering=triple"))
+        {
+            display_buffering = true;
+            display_buffering_mode = LV_DISPLAY_BUFFERING_MODE_TRIPLE;
+        }
+        else if (0 == std::strncmp(argv[i], "--flush-queue-depth=", 20))
+        {
+            flush_queue_depth = std::strtoul(argv[i] + 20, NULL, 10);
+        }
+        else if (0 == std::strncmp(argv[i], "--dirty-area-overhead=", 22))
+        {
+            dirty_area_overhead = std::strtoul(argv[i] + 22, NULL, 10);
+        }
+        else if (0 == std::strncmp(argv[i], "--render-cost=", 14))
+        {
+            render_cost = std::strtoul(argv[i] + 14, NULL, 10);
+        }
+        else
+        {
+            std::fprintf(stderr, "Unknown option: %s\n", argv[i]);
+            return -1;
+        }
+    }
+
+    // Resolved after parsing, so the order of the options doesn't matter.
+    if (benchmark_output && !image_cache_demo)
+    {
+        benchmark_demo = true;
+    }
+
+    lv_init();
+
+    if (!lv_run_loop_init())
     {
         return -1;
     }
 
-    lv_demo_widgets();
-    //lv_demo_benchmark();
+    if (parallel_draw)
+    {
+        if (!lv_parallel_draw_init(draw_workers))
+        {
+            return -1;
+        }
 
-    while (1)
+        if (!lv_parallel_draw_set_tile_size(draw_tile_width, draw_tile_height))
+        {
+            std::fprintf(stderr, "Invalid draw tile size.\n");
+            return -1;
+        }
+
+        lv_stats_monitor_add_source(
+            "Shadow cache",
+            lv_shadow_cache_format_stats,
+            NULL);
+        lv_stats_monitor_add_source(
+            "Circle cache",
+            lv_circle_cache_format_stats,
+            NULL);
+    }
+
+    if (!lv_draw_cache_init(draw_cache_size))
+    {
+        std::fprintf(stderr, "Invalid draw cache size.\n");
+        return -1;
+    }
+    if (SIZE_MAX != shadow_cache_size)
     {
-        uint32_t time_till_next = lv_timer_handler();
-        lv_delay_ms(time_till_next);
+        lv_shadow_cache_set_budget(shadow_cache_size);
+    }
+    if (SIZE_MAX != circle_cache_size)
+    {
+        lv_circle_cache_set_budget(circle_cache_size);
+    }
+    lv_stats_monitor_add_source(
+        "Image cache",
+        lv_draw_cache_format_stats,
+        reinterpret_cast<void*>(
+            static_cast<uintptr_t>(LV_DRAW_CACHE_TYPE_IMAGE)));
+
+    /*
+     * Optional workaround for users who wants UTF-8 console output.
+     * If you don't want that behavior can comment them out.
+     *
+     * Suggested by jinsc123654.
+     */
+#if defined(_WIN32) && LV_TXT_ENC == LV_TXT_ENC_UTF8
+    SetConsoleCP(CP_UTF8);
+    SetConsoleOutputCP(CP_UTF8);
+#endif
+
+    lv_display_t* display = headless_mode
+        ? lv_headless_create_display(800, 480)
+        : create_simulator_display();
+    if (!display)
+    {
+        return -1;
+    }
+    if (!headless_mode)
+    {
+        lv_run_loop_attach_display(display);
+    }
+    else if (render_cost)
+    {
+        lv_headless_set_render_cost(display, render_cost);
+    }
+    if (display_buffering)
+    {
+        if (!lv_display_buffering_set_queue_depth(flush_queue_depth))
+        {
+            std::fprintf(stderr, "Invalid flush queue depth.\n");
+            return -1;
+        }
+        if (!lv_display_buffering_attach_display(
+            display,
+            display_buffering_mode,
+            headless_mode ? lv_headless_present_frame : NULL,
+            NULL))
+        {
+            return -1;
+        }
+        lv_stats_monitor_add_source(
+            "Display buffering",
+            lv_display_buffering_format_stats,
+            display);
+    }
+    lv_slab_allocator_attach_display(display);
+    if (!lv_dirty_area_coalescer_attach_display(display, dirty_area_overhead))
+    {
+        return -1;
+    }
+    lv_stats_monitor_add_source(
+        "Dirty areas",
+        lv_dirty_area_coalescer_format_stats,
+        display);
+    lv_frame_histogram_attach_display(display);
+    lv_stats_monitor_add_source(
+        "Frame time",
+        lv_frame_histogram_format_stats,
+        NULL);
+
+    if (frame_pacing < 0)
+    {
+        frame_pacing = headless_mode ? 0 : 1;
+    }
+    if (frame_pacing)
+    {
+        if (headless_mode)
+        {
+            lv_frame_scheduler_set_clock_cb(lv_headless_get_time);
+            if (!frame_pacing_period)
+            {
+                frame_pacing_period = LV_DEF_REFR_PERIOD * 1000;
+            }
+        }
+        if (!lv_frame_scheduler_attach_display(display, frame_pacing_period))
+        {
+            return -1;
+        }
+        if (headless_mode)
+        {
+            lv_headless_set_vsync_cb(
+                display,
+                frame_pacing_period,
+                lv_frame_scheduler_signal_vsync);
+        }
+        else if (!frame_pacing_period)
+        {
+            // Fall back to the refresh rate of the monitor if the host has no
+            // vsync source.
+            lv_frame_scheduler_start_host_vsync(display);
+        }
+        lv_stats_monitor_add_source(
+            "Frame pacing",
+            lv_frame_scheduler_format_stats,
+            display);
+    }
+
+    if (UINT32_MAX == adaptive_refresh_period)
+    {
+        adaptive_refresh_period =
+            headless_mode ? 0 : LV_ADAPTIVE_REFRESH_MAX_PERIOD;
+    }
+    if (adaptive_refresh_period)
+    {
+        if (!lv_adaptive_refresh_attach_display(
+            display,
+            adaptive_refresh_period))
+        {
+            return -1;
+        }
+        lv_stats_monitor_add_source(
+            "Adaptive refresh",
+            lv_adaptive_refresh_format_stats,
+            display);
+    }
+    lv_stats_monitor_add_source(
+        "Run loop",
+        lv_run_loop_format_stats,
+        NULL);
+    lv_stats_monitor_add_source(
+        "Style cache",
+        lv_style_cache_format_stats,
+        NULL);
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+    lv_stats_monitor_add_source(
+        "Allocator",
+        lv_slab_allocator_format_stats,
+        NULL);
+#endif
+
+    if (style_benchmark)
+    {
+        return lv_benchmark_scenes_style_lookup(5000, 100) ? 0 : 1;
+    }
+
+    if (alloc_benchmark)
+    {
+        if (!lv_benchmark_scenes_widgets_allocation(50))
+        {
+            return 1;
+        }
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+        lv_slab_allocator_dump();
+#endif
+        return 0;
+    }
+
+    if (alloc_trace_output)
+    {
+        if (!lv_allocation_tracer_start(0))
+        {
+            return -1;
+        }
+        lv_allocation_tracer_attach_display(display);
+    }
+
+    if (profile_trace_output)
+    {
+        if (!lv_profiler_trace_start(profile_trace_output))
+        {
+            std::fprintf(stderr, "The profiler is not enabled.\n");
+            return -1;
+        }
+        if (!headless_mode)
+        {
+            lv_profiler_trace_attach_display(display);
+        }
+    }
+
+#if LV_USE_SYSMON
+    if (!headless_mode)
+    {
+        lv_stats_monitor_show(display, 1000);
+    }
+#endif
+
+    if (benchmark_output)
+    {
+        if (headless_mode)
+        {
+            synthetic_clock = true;
+            lv_headless_set_synthetic_clock(true);
+        }
+
+        if (image_cache_demo)
+        {
+            static const char* const scene_names[] = { "Image cache" };
+            lv_benchmark_runner_set_scene_names(scene_names, 1);
+        }
+
+        if (!lv_benchmark_runner_start(
+            display,
+            benchmark_frames,
+            benchmark_scene_timeout))
+        {
+            return -1;
+        }
+    }
+
+    if (benchmark_demo)
+    {
+        lv_demo_benchmark();
+    }
+    else if (image_cache_demo)
+    {
+        if (!lv_benchmark_scenes_image_cache(10000))
+        {
+            return -1;
+        }
+    }
+    else
+    {
+        lv_demo_widgets();
+    }
+
+    uint32_t start_tick = lv_tick_get();
+
+    while (!duration || lv_tick_elaps(start_tick) < duration)
+    {
+        if (benchmark_output && lv_benchmark_runner_is_finished())
+        {
+            break;
+        }
+
+        uint32_t time_till_next = lv_run_loop_handler();
+        if (duration)
+        {
+            // Don't sleep beyond the end of the specified running time.
+            time_till_next = LV_MIN(
+                time_till_next,
+                duration - LV_MIN(lv_tick_elaps(start_tick), duration));
+        }
+        if (synthetic_clock)
+        {
+            // The synthetic clock only advances in lv_delay_ms.
+            lv_delay_ms(time_till_next);
+        }
+        else
+        {
+            lv_run_loop_wait(time_till_next);
+        }
+    }
+
+    if (headless_mode)
+    {
+        uint32_t elapsed = lv_tick_elaps(start_tick);
+        uint32_t frame_count = lv_headless_get_frame_count(display);
+        std::printf(
+            "Rendered %u frames in %u ms (%u FPS).\n",
+            frame_count,
+            elapsed,
+            elapsed ? frame_count * 1000 / elapsed : 0);
+
+        lv_parallel_draw_stats_t stats;
+        if (lv_parallel_draw_get_stats(&stats))
+        {
+            std::printf(
+                "Executed %llu draw tasks on %u workers (%llu stolen).\n",
+                static_cast<unsigned long long>(stats.executed_task_count),
+                stats.worker_count,
+                static_cast<unsigned long long>(stats.stolen_task_count));
+            std::printf(
+                "Split %llu draw tasks into %llu tiles.\n",
+                static_cast<unsigned long long>(stats.split_task_count),
+                static_cast<unsigned long long>(stats.tile_count));
+        }
+
+        lv_stats_monitor_print();
+    }
+
+    if (draw_cache_dump)
+    {
+        lv_draw_cache_dump();
+    }
+
+    if (alloc_trace_output)
+    {
+        lv_allocation_tracer_stop();
+        if (!lv_allocation_tracer_write_summary(alloc_trace_output))
+        {
+            std::fprintf(
+                stderr,
+                "Failed to write the allocation trace to %s.\n",
+                alloc_trace_output);
+            return 1;
+        }
+    }
+
+    if (profile_trace_output)
+    {
+        if (!lv_profiler_trace_write())
+        {
+            std::fprintf(
+                stderr,
+                "Failed to write the profiler trace to %s.\n",
+                profile_trace_output);
+            return 1;
+        }
+    }
+
+    if (benchmark_output)
+    {
+        if (!lv_benchmark_runner_is_finished())
+        {
+            std::fprintf(stderr, "The benchmark is not finished.\n");
+            return 1;
+        }
+
+        if (!lv_benchmark_runner_write_results(benchmark_output))
+        {
+            std::fprintf(
+                stderr,
+                "Failed to write the benchmark results to %s.\n",
+                benchmark_output);
+            return 1;
+        }
     }
 
     return 0;